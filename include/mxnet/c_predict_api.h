@@ -49,6 +49,18 @@ typedef float mx_float;
 typedef void* PredictorHandle;
 /*! \brief handle to NDArray list */
 typedef void* NDListHandle;
+/*! \brief handle to batching Predictor */
+typedef void* BatchingPredictorHandle;
+/*! \brief handle to a pool of Predictors sharing weights */
+typedef void* PredictorPoolHandle;
+/*!
+ * \brief callback invoked once an asynchronous forward completes.
+ * \param handle The handle of the predictor.
+ * \param status 0 when success, -1 when failure. On failure, MXGetLastError
+ *  called from the callback returns the error.
+ * \param user_data The user data given to MXPredForwardAsync.
+ */
+typedef void (*PredForwardCallback)(PredictorHandle handle, int status, void* user_data);
 
 MXNET_DLL int MXPredInit();
 
@@ -149,12 +161,45 @@ MXNET_DLL int MXPredGetOutputShape(PredictorHandle handle, mx_uint index, mx_uin
  * \return 0 when success, -1 when failure.
  */
 MXNET_DLL int MXPredSetInput(PredictorHandle handle, const char* key, const mx_float* data, mx_uint size);
+/*!
+ * \brief Bind a caller owned buffer as the storage of an input (cpu only).
+ *  Later forwards read the input directly from data, so MXPredSetInput is
+ *  not needed: write the input into data and call MXPredForward. The buffer
+ *  must hold the whole input, be aligned to 16 bytes, stay valid until the
+ *  predictor is freed or another buffer is bound to the input, and must not
+ *  be written while a forward is running (before MXPredGetOutput,
+ *  MXPredGetOutputPtr or the MXPredForwardAsync callback returns). Binding
+ *  rebinds the executor, so it should be done once rather than per forward.
+ * \param handle The handle of the predictor.
+ * \param key The name of the input.
+ * \param data The buffer.
+ * \param size The number of elements of data.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredBindInput(PredictorHandle handle, const char* key, mx_float* data, mx_uint size);
 /*!
  * \brief Run a forward pass to get the output.
  * \param handle The handle of the predictor.
  * \return 0 when success, -1 when failure.
  */
 MXNET_DLL int MXPredForward(PredictorHandle handle);
+/*!
+ * \brief Run a forward pass without blocking.
+ *  The forward and the copies of the outputs to the host are pushed to the
+ *  engine, and the call returns immediately. Once the outputs are on the host,
+ *  callback is invoked from a completion thread shared by all the predictors
+ *  of the process, after which MXPredGetOutput returns without waiting. On cpu
+ *  predictors the outputs are read in place, without a copy. The other calls
+ *  on the predictor wait for the pending forward to complete first. The
+ *  callback should be short (for example, signal a condition variable), since
+ *  it delays the completion of the other forwards, and must not call the
+ *  predictor API on the same predictor.
+ * \param handle The handle of the predictor.
+ * \param callback The completion callback, may be NULL.
+ * \param user_data Passed to the callback.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredForwardAsync(PredictorHandle handle, PredForwardCallback callback, void* user_data);
 /*!
  * \brief Run a interactive forward pass to get the output.
  *  This is helpful for displaying progress of prediction which can be slow.
@@ -181,12 +226,104 @@ MXNET_DLL int MXPredPartialForward(PredictorHandle handle, int step, int* step_l
  * \return 0 when success, -1 when failure.
  */
 MXNET_DLL int MXPredGetOutput(PredictorHandle handle, mx_uint index, mx_float* data, mx_uint size);
+/*!
+ * \brief Get the output of the prediction in place, without a copy (cpu only).
+ *  Waits for the forward like MXPredGetOutput. The returned pointer is owned
+ *  by the predictor and is valid until the next forward, reshape, input
+ *  binding or free of the predictor.
+ * \param handle The handle of the predictor.
+ * \param index The index of output node, set to 0 if there is only one output.
+ * \param data The output data.
+ * \param size The number of elements of data.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredGetOutputPtr(PredictorHandle handle, mx_uint index, const mx_float** data, mx_uint* size);
 /*!
  * \brief Free a predictor handle.
  * \param handle The handle of the predictor.
  * \return 0 when success, -1 when failure.
  */
 MXNET_DLL int MXPredFree(PredictorHandle handle);
+/*!
+ * \brief Create a predictor that shares the weights of another predictor.
+ *  The new predictor owns its inputs, outputs and activation memory (and a
+ *  copy of the small auxiliary states), so the two can run MXPredForward
+ *  concurrently from different threads without a second copy of the weights.
+ *  The predictors can be freed in any order: the weights are released once
+ *  the last predictor using them is freed.
+ * \param handle The predictor owning the weights.
+ * \param out The created predictor, freed with MXPredFree.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredCreateShared(PredictorHandle handle, PredictorHandle* out);
+/*!
+ * \brief Create a pool of size predictors sharing the weights of a predictor
+ *  (see MXPredCreateShared). Serving threads acquire a predictor from the
+ *  pool, use it with the MXPred functions and release it. The predictor given
+ *  may be freed before the pool.
+ * \param handle The predictor owning the weights.
+ * \param size The number of predictors of the pool.
+ * \param out The created pool.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredPoolCreate(PredictorHandle handle, mx_uint size, PredictorPoolHandle* out);
+/*!
+ * \brief Acquire a predictor of the pool, waiting until one is released if
+ *  every predictor is in use. Thread safe.
+ * \param handle The pool.
+ * \param out The acquired predictor. It must not be freed.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredPoolAcquire(PredictorPoolHandle handle, PredictorHandle* out);
+/*!
+ * \brief Release a predictor acquired from the pool. Thread safe.
+ * \param handle The pool.
+ * \param pred The predictor.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredPoolRelease(PredictorPoolHandle handle, PredictorHandle pred);
+/*!
+ * \brief Free a pool and its predictors. No predictor may be in use.
+ * \param handle The pool.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredPoolFree(PredictorPoolHandle handle);
+/*!
+ * \brief Create a batching predictor in front of a predictor.
+ *  Concurrent MXPredBatchingPredict calls are coalesced into batches of up to
+ *  max_batch_size samples, which run as one forward. A batch runs once it is
+ *  full or once its oldest request has waited max_delay_us microseconds.
+ *  Executors are prepared for the power of two batch sizes up to
+ *  max_batch_size and share the weights of the predictor, which may be freed
+ *  before the batching predictor.
+ * \param handle The predictor, created with any batch size.
+ * \param input_key The input whose first dimension is the batch.
+ * \param output_index The output returned to the requests.
+ * \param max_batch_size The maximum number of samples in a batch.
+ * \param max_delay_us The maximum time a request waits for a batch to fill.
+ * \param out The created batching predictor.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredCreateBatching(PredictorHandle handle, const char* input_key, mx_uint output_index,
+                                   mx_uint max_batch_size, mx_uint max_delay_us, BatchingPredictorHandle* out);
+/*!
+ * \brief Run the prediction of one sample through a batching predictor.
+ *  Blocks until the batch holding the sample completes. Thread safe.
+ * \param handle The batching predictor.
+ * \param input The input of one sample.
+ * \param input_size The number of elements of one sample of the input.
+ * \param output User allocated data to hold the output of the sample.
+ * \param output_size The number of elements of one sample of the output.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredBatchingPredict(BatchingPredictorHandle handle, const mx_float* input, mx_uint input_size,
+                                    mx_float* output, mx_uint output_size);
+/*!
+ * \brief Free a batching predictor. Pending requests complete first.
+ * \param handle The batching predictor.
+ * \return 0 when success, -1 when failure.
+ */
+MXNET_DLL int MXPredBatchingFree(BatchingPredictorHandle handle);
 /*!
  * \brief Create a NDArray List by loading from ndarray file.
  *     This can be used to load mean image file.
@@ -47,6 +47,7 @@
 #include <utility>
 #include <vector>
 #include "./c_api_common.h"
+#include "./upr_packed_ndarray.h"
 #include "../operator/custom/custom-inl.h"
 #include "../operator/tensor/matrix_op-inl.h"
 
@@ -320,7 +321,9 @@ int MXNDArrayLoad(const char *fname, mx_uint *out_size, NDArrayHandle **out_arr,
   API_BEGIN();
   std::vector<NDArray> data;
   std::vector<std::string> &names = ret->ret_vec_str;
-  {
+  if (upr::is_packed_model_file(fname)) {
+    upr::load_packed_ndarrays(fname, &data, &names);
+  } else {
     std::unique_ptr<dmlc::Stream> fi(dmlc::Stream::Create(fname, "r"));
     mxnet::NDArray::Load(fi.get(), &data, &names);
   }
@@ -353,7 +356,9 @@ int MXNDArrayLoadFromBuffer(const void *ndarray_buffer,
   CHECK_NOTNULL(ndarray_buffer);
   std::vector<NDArray> data;
   std::vector<std::string> &names = ret->ret_vec_str;
-  {
+  if (upr::is_packed_model(ndarray_buffer, size)) {
+    upr::load_packed_ndarrays(ndarray_buffer, size, /*copy=*/true, &data, &names);
+  } else {
     std::unique_ptr<dmlc::MemoryFixedSizeStream> fi(new dmlc::MemoryFixedSizeStream(
         const_cast<void*>(ndarray_buffer), size));
     mxnet::NDArray::Load(fi.get(), &data, &names);
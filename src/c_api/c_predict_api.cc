@@ -26,8 +26,16 @@
 #include "../operator/operator_common.h"
 #include "./c_api_common.h"
 #include "./ipc.h"
+#include "./upr_batcher.h"
+#include "./upr_completion_queue.h"
+#include "./upr_object_pool.h"
+#include "./upr_packed_ndarray.h"
+#include "./upr_prepared_graph.h"
+#include "./upr_template_cache.h"
 #include <dmlc/base.h>
 #include <dmlc/memory_io.h>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mxnet/c_predict_api.h>
 #include <mxnet/executor.h>
@@ -39,6 +47,40 @@
 
 using namespace mxnet;
 
+// the weights a predictor opened through uprd. the predictors created from it
+// (MXPredCreateShared, MXPredPoolCreate, MXPredReshape) read the same memory,
+// so the handle is closed when the last predictor using the weights is freed,
+// whatever the order of the frees
+struct MXAPIPredictorWeights {
+  std::string handle_id;
+  std::string model_name;
+  std::string model_id;
+  // the arrays reading the weights, waited for before the handle is closed
+  std::vector<NDArray> arrays;
+  // the predictors using the weights
+  std::atomic<size_t> num_users{1};
+};
+
+static MXAPIPredictorWeights *acquire_weights(MXAPIPredictorWeights *weights) {
+  if (weights != nullptr) {
+    weights->num_users++;
+  }
+  return weights;
+}
+
+static void release_weights(MXAPIPredictorWeights *weights) {
+  if (weights == nullptr || --weights->num_users != 0) {
+    return;
+  }
+  std::unique_ptr<MXAPIPredictorWeights> last(weights);
+  // the weights may be unmapped or evicted once the handle is closed, so the
+  // pending operations reading them finish first
+  for (const auto &nd : last->arrays) {
+    nd.WaitToWrite();
+  }
+  upr::Unload(last->handle_id, last->model_name, last->model_id);
+}
+
 // predictor interface
 struct MXAPIPredictor {
   // output arrays
@@ -59,6 +101,16 @@ struct MXAPIPredictor {
   nnvm::Symbol sym;
   // Context
   Context ctx;
+  // host copies of the outputs written by MXPredForwardAsync
+  std::vector<NDArray> host_out_arrays;
+  // set once the host copies hold the outputs of the last forward
+  std::atomic<bool> host_outputs_ready{false};
+  // the last MXPredForwardAsync, joined before the predictor is used again
+  upr::pending_forward async_forward;
+  // the arguments not loaded from the params (the inputs)
+  std::vector<size_t> input_indices;
+  // the weights opened through uprd, null without uprd
+  MXAPIPredictorWeights *weights{nullptr};
 };
 
 struct MXAPINDList {
@@ -81,31 +133,122 @@ int MXPredCreate(const char *symbol_json_str, const void *param_bytes, int param
 }
 namespace mxnet {} // namespace mxnet
 
-int MXPredCreatePartialOut(const char *symbol_json_str, const void *param_bytes, int param_size, int dev_type,
-                           int dev_id, mx_uint num_input_nodes, const char **input_keys,
-                           const mx_uint *input_shape_indptr, const mx_uint *input_shape_data, mx_uint num_output_nodes,
-                           const char **output_keys, PredictorHandle *out) {
-  using nnvm::Symbol;
+// the parts of a predictor that only depend on the symbol, the outputs, the
+// input shapes and the context. templates are cached (UPR_PREDICTOR_CACHE_SIZE)
+// so creating a predictor for a model seen before only loads and binds arrays
+struct MXAPIPredictorTemplate {
+  // symbol restricted to the requested outputs
+  nnvm::Symbol sym;
+  std::vector<std::string> arg_names;
+  std::vector<std::string> aux_names;
+  std::unordered_set<std::string> arg_name_set;
+  std::unordered_set<std::string> aux_name_set;
+  // inferred shapes
+  std::vector<TShape> arg_shapes;
+  std::vector<TShape> out_shapes;
+  std::vector<TShape> aux_shapes;
+  // key to arguments
+  std::unordered_map<std::string, size_t> key2arg;
+};
 
-  MXAPIPredictor *ret = new MXAPIPredictor();
-  API_BEGIN();
-  Symbol sym;
-  // make sure symbols are registered
-  {
-    mx_uint outSize;
-    const char **outArray;
-    MXListAllOpNames(&outSize, &outArray);
+static upr::template_cache<MXAPIPredictorTemplate> &predictor_templates() {
+  static upr::template_cache<MXAPIPredictorTemplate> cache(upr::UPR_PREDICTOR_CACHE_SIZE);
+  return cache;
+}
+
+// infers the shapes of the arguments, outputs and auxiliary states of sym
+// given the shapes of its inputs
+static void infer_predictor_shapes(const nnvm::Symbol &sym, const std::unordered_map<std::string, TShape> &known_shape,
+                                   std::vector<TShape> *arg_shapes, std::vector<TShape> *out_shapes,
+                                   std::vector<TShape> *aux_shapes) {
+  try {
+    std::vector<TShape> in_shapes;
+    for (std::string key : sym.ListInputNames(nnvm::Symbol::kAll)) {
+      const auto it = known_shape.find(key);
+      if (it != known_shape.end()) {
+        in_shapes.push_back(it->second);
+      } else {
+        in_shapes.push_back(TShape());
+      }
+    }
+    nnvm::Graph g;
+    g.outputs           = sym.outputs;
+    g                   = mxnet::exec::InferShape(std::move(g), std::move(in_shapes), "__shape__");
+    bool infer_complete = (g.GetAttr<size_t>("shape_num_unknown_nodes") == 0);
+    CHECK(infer_complete) << "The shape information of is not enough to get the shapes";
+    CopyAttr(g.indexed_graph(), g.GetAttr<nnvm::ShapeVector>("shape"), arg_shapes, out_shapes, aux_shapes);
+  } catch (const mxnet::op::InferShapeError &err) {
+    throw dmlc::Error(err.msg);
   }
-  if (symbol_json_str == nullptr) {
-    cudaFree(0);
-    delete ret;
-    return 0;
+}
+
+// sets the symbol and the argument and auxiliary names of the template
+static void set_template_names(const nnvm::Symbol &sym, MXAPIPredictorTemplate *res) {
+  res->sym       = sym;
+  res->arg_names = sym.ListInputNames(nnvm::Symbol::kReadOnlyArgs);
+  res->aux_names = sym.ListInputNames(nnvm::Symbol::kAuxiliaryStates);
+  res->arg_name_set.insert(res->arg_names.begin(), res->arg_names.end());
+  res->aux_name_set.insert(res->aux_names.begin(), res->aux_names.end());
+  for (size_t i = 0; i < res->arg_names.size(); ++i) {
+    res->key2arg[res->arg_names[i]] = i;
+  }
+}
+
+// builds the template from a graph prepared by uprd, which is already
+// upgraded and shape inferred. returns nullptr if the graph cannot be used
+// for the input shapes
+static std::shared_ptr<const MXAPIPredictorTemplate>
+build_predictor_template_from_graph(const std::string &graph_json, mx_uint num_input_nodes, const char **input_keys,
+                                    const mx_uint *input_shape_indptr, const mx_uint *input_shape_data) {
+  auto span = upr::start_span("load_prepared_graph", "create");
+  defer(upr::stop_span(span));
+
+  nnvm::Graph g;
+  try {
+    g = upr::load_prepared_graph(graph_json);
+  } catch (const std::exception &error) {
+    LOG(WARNING) << "ignoring the prepared graph. " << error.what();
+    return nullptr;
+  }
+  const auto &idx    = g.indexed_graph();
+  const auto &shapes = g.GetAttr<nnvm::ShapeVector>("shape");
+  for (mx_uint i = 0; i < num_input_nodes; ++i) {
+    const TShape shape(input_shape_data + input_shape_indptr[i], input_shape_data + input_shape_indptr[i + 1]);
+    bool matches = false;
+    for (const auto nid : idx.input_nodes()) {
+      if (idx[nid].source->attrs.name == input_keys[i]) {
+        matches = shapes[idx.entry_id(nid, 0)] == shape;
+      }
+    }
+    if (!matches) {
+      LOG(WARNING) << "ignoring the prepared graph. it was not prepared for the shape of " << input_keys[i];
+      return nullptr;
+    }
   }
+
+  auto res = std::make_shared<MXAPIPredictorTemplate>();
+  nnvm::Symbol sym;
+  sym.outputs = g.outputs;
+  set_template_names(sym, res.get());
+  CopyAttr(idx, shapes, &res->arg_shapes, &res->out_shapes, &res->aux_shapes);
+  return res;
+}
+
+// parses the symbol, selects the outputs and infers the shapes
+static std::shared_ptr<const MXAPIPredictorTemplate>
+build_predictor_template(const std::string &symbol_json, mx_uint num_input_nodes, const char **input_keys,
+                         const mx_uint *input_shape_indptr, const mx_uint *input_shape_data, mx_uint num_output_nodes,
+                         const char **output_keys) {
+  using nnvm::Symbol;
+
+  auto res = std::make_shared<MXAPIPredictorTemplate>();
+  Symbol sym;
+
   // load in the symbol.
   auto span = upr::start_span("load_symbol", "create");
   {
     nnvm::Graph g;
-    g.attrs["json"] = std::make_shared<nnvm::any>(std::string(symbol_json_str));
+    g.attrs["json"] = std::make_shared<nnvm::any>(symbol_json);
     sym.outputs     = nnvm::ApplyPass(g, "LoadLegacyJSON").outputs;
   }
   // looks likely to output the internal results
@@ -128,32 +271,122 @@ int MXPredCreatePartialOut(const char *symbol_json_str, const void *param_bytes,
   }
   upr::stop_span(span);
 
+  // shape inference
+  span = upr::start_span("shape_inference", "create");
+  std::unordered_map<std::string, TShape> known_shape;
+  for (mx_uint i = 0; i < num_input_nodes; ++i) {
+    known_shape[std::string(input_keys[i])] =
+        TShape(input_shape_data + input_shape_indptr[i], input_shape_data + input_shape_indptr[i + 1]);
+  }
+  set_template_names(sym, res.get());
+  infer_predictor_shapes(sym, known_shape, &res->arg_shapes, &res->out_shapes, &res->aux_shapes);
+  upr::stop_span(span);
+
+  return res;
+}
+
+int MXPredCreatePartialOut(const char *symbol_json_str, const void *param_bytes, int param_size, int dev_type,
+                           int dev_id, mx_uint num_input_nodes, const char **input_keys,
+                           const mx_uint *input_shape_indptr, const mx_uint *input_shape_data, mx_uint num_output_nodes,
+                           const char **output_keys, PredictorHandle *out) {
+  MXAPIPredictor *ret = new MXAPIPredictor();
+  API_BEGIN();
+  // make sure symbols are registered
+  {
+    mx_uint outSize;
+    const char **outArray;
+    MXListAllOpNames(&outSize, &outArray);
+  }
+  if (symbol_json_str == nullptr) {
+    cudaFree(0);
+    delete ret;
+    return 0;
+  }
+  // a packed model is used in place. the arrays point into param_bytes, and
+  // the symbol may be embedded in it
+  const bool packed_params = !upr::UPR_ENABLED && upr::is_packed_model(param_bytes, param_size);
+  std::vector<NDArray> packed_data;
+  std::vector<std::string> packed_names;
+  std::string symbol_json(symbol_json_str);
+  if (packed_params) {
+    std::string packed_symbol_json;
+    upr::load_packed_ndarrays(param_bytes, param_size, /*copy=*/false, &packed_data, &packed_names,
+                              &packed_symbol_json);
+    if (symbol_json.empty()) {
+      symbol_json = packed_symbol_json;
+    }
+  }
+  CHECK(!symbol_json.empty()) << "the symbol must be specified unless it is embedded in a packed model";
+
+  const auto template_key =
+      upr::to_template_key(symbol_json, std::vector<std::string>(output_keys, output_keys + num_output_nodes),
+                           std::vector<std::string>(input_keys, input_keys + num_input_nodes), input_shape_indptr,
+                           input_shape_data, dev_type, dev_id);
+  std::shared_ptr<const MXAPIPredictorTemplate> tmpl = predictor_templates().find(template_key);
+
+  // with uprd the model is opened first, so that on a template miss the
+  // graph prepared by uprd can be used. the symbol is trusted to be the one of
+  // the model, as uprd serves the weights of UPR_MODEL_NAME regardless of it
+  std::vector<NDArray> upr_data;
+  std::vector<std::string> upr_names;
+  std::string graph_json;
+  if (upr::UPR_ENABLED) {
+    const auto model_name = upr::get_model_name();
+#ifdef MXNET_USE_CUDA
+    const bool request_graph =
+        tmpl == nullptr && upr::UPR_PREPARED_GRAPH && num_input_nodes == 1 && num_output_nodes == 0;
+    const auto info = upr::Load(
+        std::string(model_name), &upr_data, &upr_names, request_graph ? &graph_json : nullptr,
+        request_graph ? input_keys[0] : "",
+        request_graph ? TShape(input_shape_data + input_shape_indptr[0], input_shape_data + input_shape_indptr[1])
+                      : TShape());
+    ret->weights             = new MXAPIPredictorWeights();
+    ret->weights->handle_id  = std::get<0>(info);
+    ret->weights->model_name = model_name;
+    ret->weights->model_id   = std::get<1>(info);
+    ret->weights->arrays     = upr_data;
+#else
+    LOG(FATAL) << "enable USE_CUDA in the makefile to use the upr path";
+#endif
+  }
+
+  // the symbol and the shapes
+  {
+    auto span = upr::start_span("predictor_template", "create");
+    tmpl      = predictor_templates().get_or_build(template_key, [&]() {
+      std::shared_ptr<const MXAPIPredictorTemplate> res;
+      if (!graph_json.empty()) {
+        res = build_predictor_template_from_graph(graph_json, num_input_nodes, input_keys, input_shape_indptr,
+                                                  input_shape_data);
+      }
+      if (res == nullptr) {
+        res = build_predictor_template(symbol_json, num_input_nodes, input_keys, input_shape_indptr,
+                                       input_shape_data, num_output_nodes, output_keys);
+      }
+      return res;
+    });
+    upr::stop_span(span);
+  }
+  const auto &sym        = tmpl->sym;
+  const auto &arg_names  = tmpl->arg_names;
+  const auto &aux_names  = tmpl->aux_names;
+  const auto &arg_shapes = tmpl->arg_shapes;
+  const auto &aux_shapes = tmpl->aux_shapes;
+  ret->key2arg           = tmpl->key2arg;
+
   // load the parameters
-  span = upr::start_span("load_params", "create");
+  auto span = upr::start_span("load_params", "create");
   std::unordered_map<std::string, NDArray> arg_params, aux_params;
   {
-    std::unordered_set<std::string> arg_names, aux_names;
-    std::vector<std::string> arg_names_vec = sym.ListInputNames(Symbol::kReadOnlyArgs);
-    std::vector<std::string> aux_names_vec = sym.ListInputNames(Symbol::kAuxiliaryStates);
-    for (size_t i = 0; i < arg_names_vec.size(); ++i) {
-      arg_names.insert(arg_names_vec[i]);
-    }
-    for (size_t i = 0; i < aux_names_vec.size(); ++i) {
-      aux_names.insert(aux_names_vec[i]);
-    }
     std::vector<NDArray> data;
     std::vector<std::string> names;
 
     if (upr::UPR_ENABLED) {
-      const auto model_name = upr::get_model_name();
-      ret->model_name       = model_name;
-#ifdef MXNET_USE_CUDA
-      const auto info = upr::Load(std::string(model_name), &data, &names);
-      ret->handle_id  = std::get<0>(info);
-      ret->model_id   = std::get<1>(info);
-#else
-      LOG(FATAL) << "enable USE_CUDA in the makefile to use the upr path";
-#endif
+      data  = upr_data;
+      names = upr_names;
+    } else if (packed_params) {
+      data  = packed_data;
+      names = packed_names;
     } else {
       auto span = upr::start_span("Create MemoryFixedSizeStream", "generic");
       dmlc::MemoryFixedSizeStream fi((void *) param_bytes, param_size); // NOLINT(*)
@@ -166,13 +399,13 @@ int MXPredCreatePartialOut(const char *symbol_json_str, const void *param_bytes,
     for (size_t i = 0; i < names.size(); ++i) {
       if (!strncmp(names[i].c_str(), "aux:", 4)) {
         std::string name(names[i].c_str() + 4);
-        if (aux_names.count(name) != 0) {
+        if (tmpl->aux_name_set.count(name) != 0) {
           aux_params[name] = data[i];
         }
       }
       if (!strncmp(names[i].c_str(), "arg:", 4)) {
         std::string name(names[i].c_str() + 4);
-        if (arg_names.count(name) != 0) {
+        if (tmpl->arg_name_set.count(name) != 0) {
           arg_params[name] = data[i];
         }
       }
@@ -180,42 +413,8 @@ int MXPredCreatePartialOut(const char *symbol_json_str, const void *param_bytes,
   }
   upr::stop_span(span);
 
-  // shape inference and bind
-  span = upr::start_span("shape_inference", "create");
-  std::unordered_map<std::string, TShape> known_shape;
-  for (mx_uint i = 0; i < num_input_nodes; ++i) {
-    known_shape[std::string(input_keys[i])] =
-        TShape(input_shape_data + input_shape_indptr[i], input_shape_data + input_shape_indptr[i + 1]);
-  }
-  std::vector<std::string> arg_names = sym.ListInputNames(Symbol::kReadOnlyArgs);
-  std::vector<std::string> aux_names = sym.ListInputNames(Symbol::kAuxiliaryStates);
-  std::vector<TShape> out_shapes(sym.ListOutputNames().size());
-  std::vector<TShape> aux_shapes(aux_names.size());
-  std::vector<TShape> arg_shapes;
-  for (size_t i = 0; i < arg_names.size(); ++i) {
-    std::string key   = arg_names[i];
-    ret->key2arg[key] = i;
-  }
-
-  try {
-    std::vector<TShape> in_shapes;
-    for (std::string key : sym.ListInputNames(Symbol::kAll)) {
-      if (known_shape.count(key) != 0) {
-        in_shapes.push_back(known_shape[key]);
-      } else {
-        in_shapes.push_back(TShape());
-      }
-    }
-    nnvm::Graph g;
-    g.outputs           = sym.outputs;
-    g                   = mxnet::exec::InferShape(std::move(g), std::move(in_shapes), "__shape__");
-    bool infer_complete = (g.GetAttr<size_t>("shape_num_unknown_nodes") == 0);
-    CHECK(infer_complete) << "The shape information of is not enough to get the shapes";
-    CopyAttr(g.indexed_graph(), g.GetAttr<nnvm::ShapeVector>("shape"), &arg_shapes, &out_shapes, &aux_shapes);
-  } catch (const mxnet::op::InferShapeError &err) {
-    throw dmlc::Error(err.msg);
-  }
-
+  // copy the parameters
+  span        = upr::start_span("copy_params", "create");
   Context ctx = Context::Create(static_cast<Context::DeviceType>(dev_type), dev_id);
 
   std::vector<NDArray> arg_arrays, aux_arrays;
@@ -230,6 +429,7 @@ int MXPredCreatePartialOut(const char *symbol_json_str, const void *param_bytes,
       }
     } else {
       arg_arrays.emplace_back(arg_shapes[i], ctx);
+      ret->input_indices.emplace_back(i);
     }
   }
   for (size_t i = 0; i < aux_shapes.size(); ++i) {
@@ -245,6 +445,15 @@ int MXPredCreatePartialOut(const char *symbol_json_str, const void *param_bytes,
       aux_arrays.emplace_back(aux_shapes[i], ctx);
     }
   }
+  if (packed_params) {
+    // the copies read from param_bytes, which the caller may release on return
+    for (auto &nd : arg_arrays) {
+      nd.WaitToRead();
+    }
+    for (auto &nd : aux_arrays) {
+      nd.WaitToRead();
+    }
+  }
   ret->arg_arrays = arg_arrays;
   upr::stop_span(span);
 
@@ -256,12 +465,15 @@ int MXPredCreatePartialOut(const char *symbol_json_str, const void *param_bytes,
     std::vector<OpReqType> grad_req(arg_arrays.size(), kNullOp);
 
     ret->exec.reset(Executor::Bind(sym, ctx, ctx_map, arg_arrays, grad_store, grad_req, aux_arrays));
-    ret->out_shapes = out_shapes;
+    ret->out_shapes = tmpl->out_shapes;
     ret->out_arrays = ret->exec->outputs();
   }
   upr::stop_span(span);
 
-  *out = ret;
+  ret->aux_arrays = aux_arrays;
+  ret->sym        = sym;
+  ret->ctx        = ctx;
+  *out            = ret;
   API_END_HANDLE_ERROR(delete ret);
 }
 
@@ -275,6 +487,7 @@ int MXPredReshape(mx_uint num_input_nodes,
   std::unique_ptr<MXAPIPredictor> ret(new MXAPIPredictor());
 
   API_BEGIN();
+  p->async_forward.join();
   // shape inference
   std::unordered_map<std::string, TShape> new_shape;
   for (mx_uint i = 0; i < num_input_nodes; ++i) {
@@ -289,6 +502,7 @@ int MXPredReshape(mx_uint num_input_nodes,
   std::vector<TShape> aux_shapes(aux_names.size());
   std::vector<TShape> arg_shapes;
   ret->key2arg = p->key2arg;
+  ret->input_indices = p->input_indices;
 
   try {
     std::vector<TShape> in_shapes;
@@ -352,6 +566,7 @@ int MXPredReshape(mx_uint num_input_nodes,
     ret->out_shapes = out_shapes;
     ret->out_arrays = ret->exec->outputs();
   }
+  ret->weights = acquire_weights(p->weights);
   *out = ret.release();
   API_END();
 }
@@ -375,6 +590,7 @@ int MXPredGetOutputShape(PredictorHandle handle,
 int MXPredSetInput(PredictorHandle handle, const char *key, const mx_float *data, mx_uint size) {
   MXAPIPredictor *p = static_cast<MXAPIPredictor *>(handle);
   API_BEGIN();
+  p->async_forward.join();
   auto it = p->key2arg.find(key);
   if (it == p->key2arg.end()) {
     LOG(FATAL) << "cannot find input key " << key;
@@ -384,16 +600,125 @@ int MXPredSetInput(PredictorHandle handle, const char *key, const mx_float *data
   API_END();
 }
 
+// caller buffers bound to cpu predictors must be aligned to this many bytes
+static const size_t kBoundBufferAlignment = 16;
+
+int MXPredBindInput(PredictorHandle handle, const char *key, mx_float *data, mx_uint size) {
+  MXAPIPredictor *p = static_cast<MXAPIPredictor *>(handle);
+  API_BEGIN();
+  CHECK_EQ(p->ctx.dev_mask(), cpu::kDevMask) << "only cpu predictors can bind caller buffers";
+  p->async_forward.join();
+  auto it = p->key2arg.find(key);
+  if (it == p->key2arg.end()) {
+    LOG(FATAL) << "cannot find input key " << key;
+  }
+  // binding a weight would write the caller buffer into the shared parameters
+  CHECK(std::find(p->input_indices.begin(), p->input_indices.end(), it->second) != p->input_indices.end())
+      << key << " is not an input of the predictor";
+  const NDArray &nd = p->arg_arrays[it->second];
+  CHECK_EQ(nd.dtype(), mshadow::kFloat32) << "the input " << key << " is not float32";
+  CHECK_EQ(size, nd.shape().Size()) << "the buffer must hold the whole input " << key;
+  CHECK_EQ(reinterpret_cast<uintptr_t>(data) % kBoundBufferAlignment, 0U)
+      << "the buffer must be aligned to " << kBoundBufferAlignment << " bytes";
+
+  // the executor is bound again with the buffer as the input, sharing the
+  // memory of the current executor (as MXPredReshape does). the predictor is
+  // only updated once the bind succeeds
+  std::vector<NDArray> arg_arrays = p->arg_arrays;
+  arg_arrays[it->second]          = NDArray(TBlob(data, nd.shape(), cpu::kDevMask), 0);
+  {
+    std::map<std::string, Context> ctx_map;
+    std::vector<NDArray> grad_store(arg_arrays.size());
+    std::vector<OpReqType> grad_req(arg_arrays.size(), kNullOp);
+    std::unique_ptr<Executor> exec(
+        Executor::Bind(p->sym, p->ctx, ctx_map, arg_arrays, grad_store, grad_req, p->aux_arrays, p->exec.get()));
+    p->exec       = std::move(exec);
+    p->arg_arrays = std::move(arg_arrays);
+    p->out_arrays = p->exec->outputs();
+  }
+  p->host_out_arrays.clear();
+  p->host_outputs_ready = false;
+  API_END();
+}
+
+int MXPredGetOutputPtr(PredictorHandle handle, mx_uint index, const mx_float **data, mx_uint *size) {
+  MXAPIPredictor *p = static_cast<MXAPIPredictor *>(handle);
+  API_BEGIN();
+  CHECK_EQ(p->ctx.dev_mask(), cpu::kDevMask) << "only the outputs of cpu predictors can be read in place";
+  p->async_forward.join();
+  CHECK_LT(index, p->out_arrays.size()) << "Output index out of range";
+  const NDArray &nd = p->out_arrays[index];
+  CHECK_EQ(nd.dtype(), mshadow::kFloat32) << "the output is not float32";
+  nd.WaitToRead();
+  *data = nd.data().dptr<mx_float>();
+  *size = static_cast<mx_uint>(nd.shape().Size());
+  API_END();
+}
+
 int MXPredForward(PredictorHandle handle) {
   MXAPIPredictor *p = static_cast<MXAPIPredictor *>(handle);
   API_BEGIN();
+  p->async_forward.join();
+  p->host_outputs_ready = false;
+  p->exec->Forward(false);
+  API_END();
+}
+
+// runs the completions of MXPredForwardAsync for every predictor of the process
+static upr::completion_queue &forward_completions() {
+  static upr::completion_queue queue;
+  return queue;
+}
+
+int MXPredForwardAsync(PredictorHandle handle, PredForwardCallback callback, void *user_data) {
+  MXAPIPredictor *p = static_cast<MXAPIPredictor *>(handle);
+  API_BEGIN();
+  p->async_forward.join();
+  p->host_outputs_ready = false;
   p->exec->Forward(false);
+  if (p->ctx.dev_mask() == cpu::kDevMask) {
+    // the outputs are already on the host
+    p->host_out_arrays = p->out_arrays;
+  } else {
+    if (p->host_out_arrays.size() != p->out_arrays.size()) {
+      // pinned copies, so the device to host copies do not stage
+      p->host_out_arrays.clear();
+      for (const auto &nd : p->out_arrays) {
+        p->host_out_arrays.emplace_back(nd.shape(), Context::CPUPinned(p->ctx.dev_id), false, nd.dtype());
+      }
+    }
+    for (size_t i = 0; i < p->out_arrays.size(); ++i) {
+      CopyFromTo(p->out_arrays[i], &p->host_out_arrays[i]);
+    }
+  }
+
+  // the completion waits on the completion queue rather than as an engine
+  // operation, since the engine skips the operations whose inputs failed and
+  // the error would never reach the callback
+  p->async_forward.post(&forward_completions(), [p, callback, user_data]() {
+    int status = 0;
+    try {
+      for (const auto &nd : p->host_out_arrays) {
+        nd.WaitToRead();
+      }
+      p->host_outputs_ready = true;
+    } catch (const std::exception &error) {
+      // the last error is thread local, so it is set on the thread running the callback
+      MXAPISetLastError(error.what());
+      status = -1;
+    }
+    if (callback != nullptr) {
+      callback(p, status, user_data);
+    }
+  });
   API_END();
 }
 
 int MXPredPartialForward(PredictorHandle handle, int step, int *step_left) {
   MXAPIPredictor *p = static_cast<MXAPIPredictor *>(handle);
   API_BEGIN();
+  p->async_forward.join();
+  p->host_outputs_ready = false;
   p->exec->PartialForward(false, step, step_left);
   API_END();
 }
@@ -402,7 +727,9 @@ int MXPredGetOutput(PredictorHandle handle, mx_uint index, mx_float *data, mx_ui
   MXAPIPredictor *p = static_cast<MXAPIPredictor *>(handle);
   API_BEGIN();
   CHECK_LT(index, p->out_arrays.size()) << "Output index out of range";
-  const NDArray &nd = p->out_arrays[index];
+  p->async_forward.join();
+  // after MXPredForwardAsync completes, the outputs are already on the host
+  const NDArray &nd = p->host_outputs_ready ? p->host_out_arrays[index] : p->out_arrays[index];
   nd.SyncCopyToCPU(data, size);
   API_END();
 }
@@ -410,10 +737,272 @@ int MXPredGetOutput(PredictorHandle handle, mx_uint index, mx_float *data, mx_ui
 int MXPredFree(PredictorHandle handle) {
   API_BEGIN();
   auto pred = static_cast<MXAPIPredictor *>(handle);
-  if (upr::UPR_ENABLED) {
-    upr::Unload(pred);
+  // the completion of a pending MXPredForwardAsync refers to the predictor
+  pred->async_forward.join();
+  std::unique_ptr<MXAPIPredictor> freed(pred);
+  release_weights(pred->weights);
+  API_END();
+}
+
+// creates a predictor that shares the weights of base and owns its inputs,
+// auxiliary states and activation memory. the auxiliary states are small and
+// are copied, since the executor declares them mutable, which would make the
+// engine serialize the forwards of the predictors sharing them
+static MXAPIPredictor *create_shared_predictor(const MXAPIPredictor *base) {
+  std::unique_ptr<MXAPIPredictor> ret(new MXAPIPredictor());
+  ret->sym           = base->sym;
+  ret->ctx           = base->ctx;
+  ret->key2arg       = base->key2arg;
+  ret->out_shapes    = base->out_shapes;
+  ret->input_indices = base->input_indices;
+
+  ret->arg_arrays = base->arg_arrays;
+  for (const auto i : ret->input_indices) {
+    const NDArray &nd  = base->arg_arrays[i];
+    ret->arg_arrays[i] = NDArray(nd.shape(), ret->ctx, false, nd.dtype());
+  }
+  for (const auto &nd : base->aux_arrays) {
+    NDArray copy(nd.shape(), ret->ctx, false, nd.dtype());
+    CopyFromTo(nd, &copy);
+    ret->aux_arrays.emplace_back(copy);
+  }
+
+  std::map<std::string, Context> ctx_map;
+  std::vector<NDArray> grad_store(ret->arg_arrays.size());
+  std::vector<OpReqType> grad_req(ret->arg_arrays.size(), kNullOp);
+  ret->exec.reset(
+      Executor::Bind(ret->sym, ret->ctx, ctx_map, ret->arg_arrays, grad_store, grad_req, ret->aux_arrays));
+  ret->out_arrays = ret->exec->outputs();
+  ret->weights    = acquire_weights(base->weights);
+  return ret.release();
+}
+
+int MXPredCreateShared(PredictorHandle handle, PredictorHandle *out) {
+  MXAPIPredictor *base = static_cast<MXAPIPredictor *>(handle);
+  API_BEGIN();
+  auto span = upr::start_span("create_shared_predictor", "create");
+  *out      = create_shared_predictor(base);
+  upr::stop_span(span);
+  API_END();
+}
+
+// predictor pool interface
+struct MXAPIPredictorPool {
+  upr::object_pool<MXAPIPredictor> pool;
+};
+
+int MXPredPoolCreate(PredictorHandle handle, mx_uint size, PredictorPoolHandle *out) {
+  MXAPIPredictor *base = static_cast<MXAPIPredictor *>(handle);
+  std::unique_ptr<MXAPIPredictorPool> ret(new MXAPIPredictorPool());
+  API_BEGIN();
+  CHECK_GT(size, 0U) << "the pool must hold at least one predictor";
+  try {
+    for (mx_uint i = 0; i < size; ++i) {
+      ret->pool.add(create_shared_predictor(base));
+    }
+  } catch (const dmlc::Error &) {
+    for (auto pred : ret->pool.objects()) {
+      MXPredFree(pred);
+    }
+    throw;
+  }
+  *out = ret.release();
+  API_END();
+}
+
+int MXPredPoolAcquire(PredictorPoolHandle handle, PredictorHandle *out) {
+  MXAPIPredictorPool *p = static_cast<MXAPIPredictorPool *>(handle);
+  API_BEGIN();
+  *out = p->pool.acquire();
+  API_END();
+}
+
+int MXPredPoolRelease(PredictorPoolHandle handle, PredictorHandle pred) {
+  MXAPIPredictorPool *p = static_cast<MXAPIPredictorPool *>(handle);
+  API_BEGIN();
+  try {
+    p->pool.release(static_cast<MXAPIPredictor *>(pred));
+  } catch (const std::runtime_error &error) {
+    throw dmlc::Error(error.what());
+  }
+  API_END();
+}
+
+int MXPredPoolFree(PredictorPoolHandle handle) {
+  API_BEGIN();
+  std::unique_ptr<MXAPIPredictorPool> p(static_cast<MXAPIPredictorPool *>(handle));
+  for (auto pred : p->pool.objects()) {
+    MXPredFree(pred);
+  }
+  API_END();
+}
+
+// an executor of a batching predictor prepared for one batch size
+struct MXAPIBatchedExecutor {
+  std::vector<NDArray> arg_arrays;
+  std::unique_ptr<Executor> exec;
+  std::vector<NDArray> out_arrays;
+};
+
+// batching predictor interface
+struct MXAPIBatchingPredictor {
+  // the predictor the weights are shared with. only used while binding
+  MXAPIPredictor *base{nullptr};
+  // the weights opened through uprd, null without uprd
+  MXAPIPredictorWeights *weights{nullptr};
+  // index of the batched input in the arguments
+  size_t input_index{0};
+  // index of the output returned to the requests
+  mx_uint output_index{0};
+  // elements of one sample of the input and of the output
+  size_t input_size{0};
+  size_t output_size{0};
+  std::vector<size_t> batch_sizes;
+  std::map<size_t, MXAPIBatchedExecutor> executors;
+  // staging buffers for the batched input and output
+  std::vector<mx_float> input_buffer;
+  std::vector<mx_float> output_buffer;
+  std::unique_ptr<upr::request_batcher> batcher;
+};
+
+// binds an executor of the base predictor for batch_size samples. the
+// weights and auxiliary states are shared with the base predictor, and the
+// intermediate memory is shared with shared_exec (the batches run one at a
+// time)
+static void bind_batched_executor(MXAPIBatchingPredictor *p, size_t batch_size, Executor *shared_exec,
+                                  MXAPIBatchedExecutor *res) {
+  const auto base = p->base;
+  TShape input_shape = base->arg_arrays[p->input_index].shape();
+  input_shape[0]     = batch_size;
+
+  std::unordered_map<std::string, TShape> known_shape;
+  for (const auto &it : base->key2arg) {
+    if (it.second == p->input_index) {
+      known_shape[it.first] = input_shape;
+    }
+  }
+  std::vector<TShape> arg_shapes, out_shapes, aux_shapes;
+  infer_predictor_shapes(base->sym, known_shape, &arg_shapes, &out_shapes, &aux_shapes);
+  CHECK_LT(p->output_index, out_shapes.size()) << "Output index out of range";
+  CHECK_EQ(out_shapes[p->output_index].Size(), batch_size * p->output_size)
+      << "the output does not scale with the batch size";
+  for (size_t i = 0; i < aux_shapes.size(); ++i) {
+    CHECK_EQ(aux_shapes[i].Size(), base->aux_arrays[i].shape().Size())
+        << "auxiliary states cannot depend on the batch size";
+  }
+
+  // the arguments (other than the input) whose shape does not depend on the
+  // batch size are shared
+  for (size_t i = 0; i < arg_shapes.size(); ++i) {
+    if (i != p->input_index && arg_shapes[i] == base->arg_arrays[i].shape()) {
+      res->arg_arrays.emplace_back(base->arg_arrays[i]);
+    } else {
+      res->arg_arrays.emplace_back(arg_shapes[i], base->ctx);
+    }
+  }
+
+  std::map<std::string, Context> ctx_map;
+  std::vector<NDArray> grad_store(res->arg_arrays.size());
+  std::vector<OpReqType> grad_req(res->arg_arrays.size(), kNullOp);
+  std::vector<NDArray> aux_arrays(base->aux_arrays);
+  res->exec.reset(Executor::Bind(base->sym, base->ctx, ctx_map, res->arg_arrays, grad_store, grad_req, aux_arrays,
+                                 shared_exec));
+  res->out_arrays = res->exec->outputs();
+}
+
+// runs the requests as one batch on the smallest prepared executor that fits
+// them. unused samples are zero
+static void run_batch(MXAPIBatchingPredictor *p, const std::vector<upr::request_batcher::request> &requests) {
+  const auto batch_size = upr::to_prepared_batch_size(p->batch_sizes, requests.size());
+  auto &executor        = p->executors.at(batch_size);
+
+  auto span = upr::start_span("batched_forward", "predict",
+                              upr::span_props{{"batch_size", std::to_string(batch_size)},
+                                         {"num_requests", std::to_string(requests.size())}});
+  defer(upr::stop_span(span));
+
+  auto &input = p->input_buffer;
+  input.assign(batch_size * p->input_size, 0);
+  for (size_t i = 0; i < requests.size(); ++i) {
+    std::copy(requests[i].input, requests[i].input + p->input_size, input.begin() + i * p->input_size);
+  }
+  executor.arg_arrays[p->input_index].SyncCopyFromCPU(input.data(), input.size());
+  executor.exec->Forward(false);
+
+  auto &output = p->output_buffer;
+  output.resize(batch_size * p->output_size);
+  executor.out_arrays[p->output_index].SyncCopyToCPU(output.data(), output.size());
+  for (size_t i = 0; i < requests.size(); ++i) {
+    std::copy(output.begin() + i * p->output_size, output.begin() + (i + 1) * p->output_size, requests[i].output);
+  }
+}
+
+int MXPredCreateBatching(PredictorHandle handle, const char *input_key, mx_uint output_index, mx_uint max_batch_size,
+                         mx_uint max_delay_us, BatchingPredictorHandle *out) {
+  MXAPIPredictor *base = static_cast<MXAPIPredictor *>(handle);
+  std::unique_ptr<MXAPIBatchingPredictor> ret(new MXAPIBatchingPredictor());
+  API_BEGIN();
+  CHECK_GT(max_batch_size, 0U) << "the max batch size must be positive";
+  auto it = base->key2arg.find(input_key);
+  if (it == base->key2arg.end()) {
+    LOG(FATAL) << "cannot find input key " << input_key;
+  }
+  CHECK_LT(output_index, base->out_arrays.size()) << "Output index out of range";
+  const TShape &input_shape  = base->arg_arrays[it->second].shape();
+  const TShape &output_shape = base->out_shapes[output_index];
+  CHECK_GE(input_shape.ndim(), 1) << "the input " << input_key << " has no batch dimension";
+  CHECK_GE(output_shape.ndim(), 1) << "the output has no batch dimension";
+
+  ret->base         = base;
+  ret->input_index  = it->second;
+  ret->output_index = output_index;
+  ret->input_size   = input_shape.Size() / input_shape[0];
+  ret->output_size  = output_shape.Size() / output_shape[0];
+  ret->batch_sizes  = upr::to_prepared_batch_sizes(max_batch_size);
+
+  // the largest executor is bound first, and the others share its memory
+  auto span = upr::start_span("bind_batched_executors", "create",
+                              upr::span_props{{"max_batch_size", std::to_string(max_batch_size)}});
+  Executor *shared_exec = nullptr;
+  for (auto size = ret->batch_sizes.rbegin(); size != ret->batch_sizes.rend(); ++size) {
+    auto &executor = ret->executors[*size];
+    bind_batched_executor(ret.get(), *size, shared_exec, &executor);
+    if (shared_exec == nullptr) {
+      shared_exec = executor.exec.get();
+    }
   }
-  delete pred;
+  upr::stop_span(span);
+
+  auto p = ret.get();
+  ret->batcher.reset(new upr::request_batcher(
+      max_batch_size, std::chrono::microseconds(max_delay_us),
+      [p](const std::vector<upr::request_batcher::request> &requests) { run_batch(p, requests); }));
+  ret->weights = acquire_weights(base->weights);
+  ret->base    = nullptr;
+  *out         = ret.release();
+  API_END();
+}
+
+int MXPredBatchingPredict(BatchingPredictorHandle handle, const mx_float *input, mx_uint input_size,
+                          mx_float *output, mx_uint output_size) {
+  MXAPIBatchingPredictor *p = static_cast<MXAPIBatchingPredictor *>(handle);
+  API_BEGIN();
+  CHECK_EQ(input_size, p->input_size) << "the input must hold one sample";
+  CHECK_EQ(output_size, p->output_size) << "the output must hold one sample";
+  try {
+    p->batcher->predict(input, output);
+  } catch (const std::runtime_error &error) {
+    throw dmlc::Error(error.what());
+  }
+  API_END();
+}
+
+int MXPredBatchingFree(BatchingPredictorHandle handle) {
+  API_BEGIN();
+  std::unique_ptr<MXAPIBatchingPredictor> p(static_cast<MXAPIBatchingPredictor *>(handle));
+  // the pending batches finish before the weights are released
+  p->batcher.reset();
+  release_weights(p->weights);
   API_END();
 }
 
@@ -13,6 +13,16 @@
 #include <grpc++/grpc++.h>
 #include <grpc/support/log.h>
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "./upr.grpc.pb.h"
 #include "./upr.pb.h"
 
@@ -26,6 +36,9 @@ namespace upr {
 std::string server::host_name = "localhost";
 int server::port              = dmlc::GetEnv("PORT", 50051);
 std::string server::address   = fmt::format("{}:{}", host_name, port);
+std::string server::socket_path = dmlc::GetEnv("UPR_SOCKET_PATH", std::string(""));
+std::string server::local_address =
+    socket_path.empty() ? address : fmt::format("unix:{}", socket_path);
 
 
 static TShape to_shape(Shape shape) {
@@ -77,7 +90,99 @@ static void *get_device_ptr(const Layer &layer) {
   return device_ptr;
 }
 
+// the read-only mappings of the shared memory segments of the open handles.
+// a segment is mapped once per process and shared by the handles opened on
+// it. since every load of a model in uprd creates a new segment, a segment is
+// unmapped as soon as its last handle is closed, so that evicting the model in
+// uprd frees its memory
+class shared_memory_mappings {
+public:
+  const void *acquire(const std::string &handle_id, const std::string &name, size_t byte_count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = mappings_.find(name);
+    if (it == mappings_.end()) {
+      it = mappings_.insert({name, mapping{map(name, byte_count), std::max(byte_count, size_t{1}), 0}}).first;
+    }
+    it->second.ref_count++;
+    handles_[handle_id] = name;
+    return it->second.ptr;
+  }
+
+  // does nothing if the handle holds no mapping, e.g. with the cuda backend
+  void release(const std::string &handle_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto handle = handles_.find(handle_id);
+    if (handle == handles_.end()) {
+      return;
+    }
+    auto it = mappings_.find(handle->second);
+    handles_.erase(handle);
+    if (--it->second.ref_count == 0) {
+      munmap(it->second.ptr, it->second.byte_count);
+      mappings_.erase(it);
+    }
+  }
+
+private:
+  struct mapping {
+    void *ptr;
+    size_t byte_count;
+    size_t ref_count;
+  };
+
+  static void *map(const std::string &name, size_t byte_count) {
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd == -1) {
+      throw dmlc::Error(fmt::format("unable to open shared memory segment {}. shm_open failed with error {}", name,
+                                    strerror(errno)));
+    }
+    defer(close(fd));
+
+    void *ptr = mmap(nullptr, std::max(byte_count, size_t{1}), PROT_READ, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+      throw dmlc::Error(
+          fmt::format("unable to map shared memory segment {}. mmap failed with error {}", name, strerror(errno)));
+    }
+    return ptr;
+  }
+
+  std::mutex mutex_;
+  // keyed by segment name
+  std::unordered_map<std::string, mapping> mappings_{};
+  // the segment name of every handle holding a mapping
+  std::unordered_map<std::string, std::string> handles_{};
+};
+
+static shared_memory_mappings *get_shared_memory_mappings() {
+  static shared_memory_mappings *mappings = new shared_memory_mappings();
+  return mappings;
+}
+
+static void to_ndarrays_from_shared_memory(std::vector<NDArray> *arrays, std::vector<std::string> *keys,
+                                           const ModelHandle &model_handle) {
+  auto map_span = start_span(
+      "mmap",
+      span_category_ipc,
+      span_props{{"model", model_handle.name()}, {"byte_count", std::to_string(model_handle.byte_count())}});
+  const char *base_ptr = (const char *) get_shared_memory_mappings()->acquire(
+      model_handle.id(), model_handle.shared_memory_name(), model_handle.byte_count());
+  stop_span(map_span);
+
+  for (const auto layer : model_handle.layer()) {
+    keys->emplace_back(layer.name());
+    const auto shape = to_shape(layer.shape());
+    // the mapping is read-only. the weights are only ever read by the executor
+    TBlob blob((void *) (base_ptr + layer.offset()), shape, cpu::kDevMask, 0);
+    arrays->emplace_back(blob, 0);
+  }
+}
+
 static void to_ndarrays(std::vector<NDArray> *arrays, std::vector<std::string> *keys, const ModelHandle &model_handle) {
+  if (model_handle.memory_backend() == MemoryBackend_CPUShared) {
+    to_ndarrays_from_shared_memory(arrays, keys, model_handle);
+    return;
+  }
+
   const auto ctx      = get_ctx();
   const auto dev_mask = ctx.dev_mask();
   const auto dev_id   = ctx.dev_id;
@@ -178,9 +283,19 @@ struct client {
       return reply;
     }
 
-    ModelHandle Open(const std::string &model_name) {
+    ModelHandle Open(const std::string &model_name, const std::string &input_name = "",
+                     const TShape &input_shape = TShape()) {
       ModelRequest request;
       request.set_name(model_name);
+      request.set_client_id(client_id());
+      if (input_shape.ndim() != 0) {
+        request.set_input_name(input_name);
+        auto shape = request.mutable_input_shape();
+        shape->set_rank(input_shape.ndim());
+        for (const auto dim : input_shape) {
+          shape->add_dim(dim);
+        }
+      }
       if (UPR_SHARING_GRANULARITY == "model") {
         request.set_sharing_granularity(SharingGranularity_Model);
       } else if (UPR_SHARING_GRANULARITY == "layer") {
@@ -189,6 +304,13 @@ struct client {
         throw dmlc::Error(
             fmt::format("Error: [{}] {}. failed to determine model granularity.", UPR_SHARING_GRANULARITY));
       }
+      if (UPR_MEMORY_BACKEND == "cuda") {
+        request.set_memory_backend(MemoryBackend_CUDA);
+      } else if (UPR_MEMORY_BACKEND == "cpu") {
+        request.set_memory_backend(MemoryBackend_CPUShared);
+      } else {
+        throw dmlc::Error(fmt::format("Error: [{}]. failed to determine memory backend.", UPR_MEMORY_BACKEND));
+      }
       return this->Open(request);
     }
 
@@ -215,6 +337,36 @@ struct client {
       return this->Close(request);
     }
 
+    Lease Heartbeat(const std::string &client_id, std::chrono::milliseconds timeout) {
+      Lease request;
+      Lease reply;
+      ClientContext context;
+      context.set_deadline(std::chrono::system_clock::now() + timeout);
+
+      request.set_client_id(client_id);
+      const auto status = stub_->Heartbeat(&context, request, &reply);
+
+      if (!status.ok()) {
+        throw dmlc::Error(
+            fmt::format("Error: [{}] {}. Heartbeat failed on client.", status.error_message(), status.error_details()));
+      }
+      return reply;
+    }
+
+    RegistryStats Stats() {
+      Void request;
+      RegistryStats reply;
+      ClientContext context;
+
+      const auto status = stub_->Stats(&context, request, &reply);
+
+      if (!status.ok()) {
+        throw dmlc::Error(
+            fmt::format("Error: [{}] {}. Stats failed on client.", status.error_message(), status.error_details()));
+      }
+      return reply;
+    }
+
   private:
     std::unique_ptr<Registry::Stub> stub_;
   };
@@ -225,23 +377,102 @@ struct client {
     return client;
   }
 
-  static void Unload(MXAPIPredictor *pred) {
-    auto span = start_span(
-        "close", span_category_close, span_props{{"model_name", pred->model_name}, {"model_id", pred->model_id}});
+  // identifies this process to uprd, which leases the handles it opens to it
+  static const std::string &client_id() {
+    static const std::string id = [] {
+      std::random_device rand;
+      return fmt::format("{}-{:08x}{:08x}", getpid(), rand(), rand());
+    }();
+    return id;
+  }
+
+  // renews the lease of the process while it has handles open. if the process
+  // dies without closing its handles, the heartbeats stop and uprd closes them
+  // once the lease expires
+  class lease_keeper {
+  public:
+    void opened(const std::string &handle_id, int64_t lease_ttl) {
+      if (lease_ttl <= 0) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      handles_.insert(handle_id);
+      // three heartbeats per ttl, so that a single lost one does not expire
+      // the lease
+      interval_ = std::max(std::chrono::milliseconds(lease_ttl / 3), std::chrono::milliseconds(1));
+      if (!started_) {
+        started_ = true;
+        // the thread lives as long as the process
+        std::thread([this]() { work(); }).detach();
+      }
+    }
+
+    void closed(const std::string &handle_id) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      handles_.erase(handle_id);
+    }
+
+  private:
+    void work() {
+      while (true) {
+        std::chrono::milliseconds interval;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          interval = interval_;
+        }
+        std::this_thread::sleep_for(interval);
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (handles_.empty()) {
+            continue;
+          }
+        }
+        try {
+          get_connection()->Heartbeat(client_id(), interval);
+        } catch (const dmlc::Error &error) {
+          LOG(ERROR) << "unable to renew the lease of the handles opened by " << client_id() << ". " << error.what();
+        }
+      }
+    }
+
+    std::mutex mutex_;
+    // the leased handles that are open
+    std::unordered_set<std::string> handles_{};
+    std::chrono::milliseconds interval_{0};
+    bool started_{false};
+  };
+
+  static lease_keeper *get_lease_keeper() {
+    static lease_keeper *keeper = new lease_keeper();
+    return keeper;
+  }
+
+  static void Unload(const std::string &handle_id, const std::string &model_name, const std::string &model_id) {
+    auto span =
+        start_span("close", span_category_close, span_props{{"model_name", model_name}, {"model_id", model_id}});
     defer(stop_span(span));
 
     auto client = client::get_connection();
-    client->Close(pred->handle_id, pred->model_id);
+    get_lease_keeper()->closed(handle_id);
+    get_shared_memory_mappings()->release(handle_id);
+    client->Close(handle_id, model_id);
 
     return;
   }
 
-  static std::pair<std::string, std::string>
-      Load(std::string model_name, std::vector<NDArray> *res_arrays, std::vector<std::string> *res_keys) {
+  static std::pair<std::string, std::string> Load(std::string model_name, std::vector<NDArray> *res_arrays,
+                                                  std::vector<std::string> *res_keys, std::string *graph_json,
+                                                  const std::string &input_name, const TShape &input_shape) {
     auto span_loading = start_span("load_model", span_category_load, span_props{{"model_name", model_name}});
     defer(stop_span(span_loading));
-    auto client           = client::get_connection();
-    const auto open_reply = client->Open(model_name); // The actual RPC call!
+    auto client = client::get_connection();
+    // The actual RPC call!
+    const auto open_reply =
+        graph_json != nullptr ? client->Open(model_name, input_name, input_shape) : client->Open(model_name);
+    if (graph_json != nullptr) {
+      *graph_json = open_reply.graph_json();
+    }
+    get_lease_keeper()->opened(open_reply.id(), open_reply.lease_ttl());
 
     // LOG(INFO) << "Client received open reply: " << open_reply.id();
 
@@ -263,19 +494,24 @@ struct client {
 
 std::string client::server_host_name = server::host_name;
 int client::server_port              = server::port;
-std::string client::server_address   = server::address;
+std::string client::server_address   = server::local_address;
 
-std::pair<std::string, std::string>
-    Load(std::string model_name, std::vector<NDArray> *data, std::vector<std::string> *keys) {
+std::pair<std::string, std::string> Load(std::string model_name, std::vector<NDArray> *data,
+                                         std::vector<std::string> *keys, std::string *graph_json,
+                                         const std::string &input_name, const TShape &input_shape) {
 
   LOG(INFO) << "UPR:: loading in Client mode";
 
-  return client::Load(model_name, data, keys);
+  return client::Load(model_name, data, keys, graph_json, input_name, input_shape);
 }
 
 void Unload(MXAPIPredictor *pred) {
+  Unload(pred->handle_id, pred->model_name, pred->model_id);
+}
+
+void Unload(const std::string &handle_id, const std::string &model_name, const std::string &model_id) {
   LOG(INFO) << "UPR:: closing in Client mode";
-  client::Unload(pred);
+  client::Unload(handle_id, model_name, model_id);
   return;
 }
 
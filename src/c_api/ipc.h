@@ -30,6 +30,7 @@
 #include "./base64.h"
 #include "./c_api_common.h"
 #include "./defer.h"
+#include "./upr_catalog.h"
 #include "fmt/format.h"
 #include "prettyprint.hpp"
 
@@ -79,14 +80,38 @@ static const auto UPR_BASE_DIR   = dmlc::GetEnv("UPR_BASE_DIR", HOME + std::stri
 static const auto UPR_ENABLE_MEMORY_PROFILE = dmlc::GetEnv("UPR_ENABLE_MEMORY_PROFILE", false);
 static const auto UPR_ENABLE_CUDA_FREE      = dmlc::GetEnv("UPR_ENABLE_CUDA_FREE", false);
 static const auto UPR_SHARING_GRANULARITY   = dmlc::GetEnv("UPR_SHARING_GRANULARITY", std::string("model"));
+static const auto UPR_MEMORY_BACKEND        = dmlc::GetEnv("UPR_MEMORY_BACKEND", std::string("cuda"));
+static const auto UPR_PREDICTOR_CACHE_SIZE  = dmlc::GetEnv("UPR_PREDICTOR_CACHE_SIZE", 64);
+static const auto UPR_PREPARED_GRAPH        = dmlc::GetEnv("UPR_PREPARED_GRAPH", true);
 
 static const auto UPRD_EVICTION_POLICY               = dmlc::GetEnv("UPRD_EVICTION_POLICY", std::string("lru"));
 static const auto UPRD_ESTIMATION_RATE               = dmlc::GetEnv("UPRD_ESTIMATION_RATE", 1.0);
 static const auto UPRD_MEMORY_PERCENTAGE             = dmlc::GetEnv("UPRD_MEMORY_PERCENTAGE", 0.8);
 static const auto UPRD_PERSIST_CPU                   = dmlc::GetEnv("UPRD_PERSIST_CPU", true);
 static const auto UPRD_PERSIST_ONLY_CPU              = dmlc::GetEnv("UPRD_PERSIST_ONLY_CPU", false);
+// in bytes. the default (0) uses half of the host memory
+static const auto UPRD_CPU_MEMORY_LIMIT              = dmlc::GetEnv("UPRD_CPU_MEMORY_LIMIT", 0.0);
+static const auto UPRD_CPU_EVICTION_POLICY           = dmlc::GetEnv("UPRD_CPU_EVICTION_POLICY", std::string("lru"));
+static const auto UPRD_CPU_COMPRESSION               = dmlc::GetEnv("UPRD_CPU_COMPRESSION", std::string("none"));
+// a tmpfs or hugetlbfs directory the cpu tier is kept in across restarts
+static const auto UPRD_CPU_TIER_DIR                  = dmlc::GetEnv("UPRD_CPU_TIER_DIR", std::string(""));
 static const auto UPRD_WRITE_PROFILE                 = dmlc::GetEnv("UPRD_WRITE_PROFILE", false);
 static const auto UPRD_ESTIMATE_WITH_INTERNAL_MEMORY = dmlc::GetEnv("UPRD_ESTIMATE_WITH_INTERNAL_MEMORY", true);
+static const auto UPRD_MEMORY_BACKEND                = dmlc::GetEnv("UPRD_MEMORY_BACKEND", std::string("cuda"));
+static const auto UPRD_ASYNC_SERVER                  = dmlc::GetEnv("UPRD_ASYNC_SERVER", true);
+static const auto UPRD_LOAD_WORKERS                  = dmlc::GetEnv("UPRD_LOAD_WORKERS", 4);
+static const auto UPRD_COMPLETION_QUEUE_THREADS      = dmlc::GetEnv("UPRD_COMPLETION_QUEUE_THREADS", 2);
+static const auto UPRD_MODEL_MANIFEST                = dmlc::GetEnv("UPRD_MODEL_MANIFEST", std::string(""));
+static const auto UPRD_WATCH_MODELS                  = dmlc::GetEnv("UPRD_WATCH_MODELS", true);
+static const auto UPRD_MMAP_PARAMS                   = dmlc::GetEnv("UPRD_MMAP_PARAMS", true);
+static const auto UPRD_PIPELINED_LOAD                = dmlc::GetEnv("UPRD_PIPELINED_LOAD", true);
+static const auto UPRD_LOAD_IO_THREADS               = dmlc::GetEnv("UPRD_LOAD_IO_THREADS", 4);
+static const auto UPRD_LOAD_CHUNK_BYTES              = dmlc::GetEnv("UPRD_LOAD_CHUNK_BYTES", 8 * 1024 * 1024);
+static const auto UPRD_DEDUP_LAYERS                  = dmlc::GetEnv("UPRD_DEDUP_LAYERS", true);
+static const auto UPRD_PREPARED_GRAPHS               = dmlc::GetEnv("UPRD_PREPARED_GRAPHS", true);
+static const auto UPRD_METRICS_FILE                  = dmlc::GetEnv("UPRD_METRICS_FILE", std::string(""));
+static const auto UPRD_METRICS_INTERVAL_MS           = dmlc::GetEnv("UPRD_METRICS_INTERVAL_MS", 10000);
+static const auto UPRD_LEASE_TTL_MS                  = dmlc::GetEnv("UPRD_LEASE_TTL_MS", 0);
 
 static const auto UPR_INPUT_CHANNELS = dmlc::GetEnv("UPR_INPUT_CHANNELS", 3);
 static const auto UPR_INPUT_WIDTH    = dmlc::GetEnv("UPR_INPUT_WIDTH", 224);
@@ -309,6 +334,10 @@ static std::string get_model_directory_path(std::string model_name = "") {
   if (model_name == "") {
     model_name = get_model_name();
   }
+  catalog_entry entry;
+  if (get_model_catalog().find(model_name, &entry)) {
+    return entry.directory_path;
+  }
   const auto it = model_directory_paths.find(model_name);
   if (it == model_directory_paths.end()) {
     throw dmlc::Error(fmt::format("unable to find {} model in model_directory_paths {}", model_name, UPR_BASE_DIR));
@@ -344,6 +373,10 @@ static std::string get_model_params_path(std::string model_name = "") {
   if (model_name == "") {
     model_name = get_model_name();
   }
+  catalog_entry entry;
+  if (get_model_catalog().find(model_name, &entry)) {
+    return entry.params_path;
+  }
   const std::string path = get_model_directory_path(model_name);
   auto model_path        = path + "/model.params";
   if (file_exists(model_path)) {
@@ -371,6 +404,10 @@ static std::string get_model_symbol_path(std::string model_name = "") {
   if (model_name == "") {
     model_name = get_model_name();
   }
+  catalog_entry entry;
+  if (get_model_catalog().find(model_name, &entry)) {
+    return entry.symbol_path;
+  }
   const std::string path = get_model_directory_path(model_name);
   auto model_path        = path + "/model.symbol";
   if (file_exists(model_path)) {
@@ -427,10 +464,30 @@ static size_t memory_total() {
   return device_total_physmem;
 }
 
+static size_t host_memory_total() {
+  const auto pages     = sysconf(_SC_PHYS_PAGES);
+  const auto page_size = sysconf(_SC_PAGE_SIZE);
+  if (pages == -1 || page_size == -1) {
+    return 0;
+  }
+  return static_cast<size_t>(pages) * static_cast<size_t>(page_size);
+}
+
+// posix shared memory names must start with a slash and contain no other slashes
+static std::string get_shared_memory_name(const std::string &model_id) {
+  return fmt::format("/upr_{}", model_id);
+}
+
 struct server {
   static std::string host_name;
   static int port;
   static std::string address;
+  // path of the unix domain socket uprd listens on (UPR_SOCKET_PATH). empty if
+  // only the tcp address is used
+  static std::string socket_path;
+  // the address clients connect to. the unix domain socket if one is
+  // configured, since uprd and its clients live on the same host
+  static std::string local_address;
 };
 
 template <typename charT>
@@ -444,8 +501,15 @@ inline bool string_starts_with(const std::basic_string<charT> &big, const std::b
 
 void Unload(mxnet::MXAPIPredictor *pred);
 
+// closes the handle handle_id opened by Load
+void Unload(const std::string &handle_id, const std::string &model_name, const std::string &model_id);
+
+// opens the model in uprd. if graph_json is not null, the prepared graph of
+// the model for the input input_name of shape input_shape is requested too
 std::pair<std::string, std::string> Load(std::string model_name, std::vector<mxnet::NDArray> *data,
-                                         std::vector<std::string> *keys);
+                                         std::vector<std::string> *keys, std::string *graph_json = nullptr,
+                                         const std::string &input_name = "",
+                                         const mxnet::TShape &input_shape = mxnet::TShape());
 
 void initialize();
 } // namespace upr
@@ -1,3349 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: upr.proto
-
-#include "upr.pb.h"
-
-#include <algorithm>
-
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
-#include <google/protobuf/descriptor.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/reflection_ops.h>
-#include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
-// @@protoc_insertion_point(includes)
-namespace upr {
-class ShapeDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Shape>
-      _instance;
-} _Shape_default_instance_;
-class LayerDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Layer>
-      _instance;
-} _Layer_default_instance_;
-class ModelHandleDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ModelHandle>
-      _instance;
-} _ModelHandle_default_instance_;
-class ModelDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Model>
-      _instance;
-} _Model_default_instance_;
-class ModelRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<ModelRequest>
-      _instance;
-} _ModelRequest_default_instance_;
-class VoidDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Void>
-      _instance;
-} _Void_default_instance_;
-}  // namespace upr
-namespace protobuf_upr_2eproto {
-void InitDefaultsShapeImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  {
-    void* ptr = &::upr::_Shape_default_instance_;
-    new (ptr) ::upr::Shape();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::upr::Shape::InitAsDefaultInstance();
-}
-
-void InitDefaultsShape() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsShapeImpl);
-}
-
-void InitDefaultsLayerImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  protobuf_upr_2eproto::InitDefaultsShape();
-  {
-    void* ptr = &::upr::_Layer_default_instance_;
-    new (ptr) ::upr::Layer();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::upr::Layer::InitAsDefaultInstance();
-}
-
-void InitDefaultsLayer() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsLayerImpl);
-}
-
-void InitDefaultsModelHandleImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  protobuf_upr_2eproto::InitDefaultsLayer();
-  {
-    void* ptr = &::upr::_ModelHandle_default_instance_;
-    new (ptr) ::upr::ModelHandle();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::upr::ModelHandle::InitAsDefaultInstance();
-}
-
-void InitDefaultsModelHandle() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsModelHandleImpl);
-}
-
-void InitDefaultsModelImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  protobuf_upr_2eproto::InitDefaultsModelHandle();
-  protobuf_google_2fprotobuf_2ftimestamp_2eproto::InitDefaultsTimestamp();
-  {
-    void* ptr = &::upr::_Model_default_instance_;
-    new (ptr) ::upr::Model();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::upr::Model::InitAsDefaultInstance();
-}
-
-void InitDefaultsModel() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsModelImpl);
-}
-
-void InitDefaultsModelRequestImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  {
-    void* ptr = &::upr::_ModelRequest_default_instance_;
-    new (ptr) ::upr::ModelRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::upr::ModelRequest::InitAsDefaultInstance();
-}
-
-void InitDefaultsModelRequest() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsModelRequestImpl);
-}
-
-void InitDefaultsVoidImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
-#else
-  ::google::protobuf::internal::InitProtobufDefaults();
-#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-  {
-    void* ptr = &::upr::_Void_default_instance_;
-    new (ptr) ::upr::Void();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::upr::Void::InitAsDefaultInstance();
-}
-
-void InitDefaultsVoid() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsVoidImpl);
-}
-
-::google::protobuf::Metadata file_level_metadata[6];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[1];
-
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Shape, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Shape, rank_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Shape, dim_),
-  ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, shape_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, byte_count_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, ipc_handle_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, device_raw_ptr_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, ref_count_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, offset_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Layer, sharing_granularity_),
-  ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, model_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, byte_count_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, layer_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, needed_eviction_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, sharing_granularity_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, device_raw_ptr_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelHandle, ipc_handle_),
-  ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, file_path_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, ref_count_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, owned_model_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, shared_model_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, lru_timestamp_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, fifo_order_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, use_history_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Model, always_resident_),
-  ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelRequest, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelRequest, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelRequest, directory_path_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelRequest, no_cache_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::ModelRequest, sharing_granularity_),
-  ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::upr::Void, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-};
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::upr::Shape)},
-  { 7, -1, sizeof(::upr::Layer)},
-  { 21, -1, sizeof(::upr::ModelHandle)},
-  { 35, -1, sizeof(::upr::Model)},
-  { 50, -1, sizeof(::upr::ModelRequest)},
-  { 59, -1, sizeof(::upr::Void)},
-};
-
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::upr::_Shape_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::upr::_Layer_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::upr::_ModelHandle_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::upr::_Model_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::upr::_ModelRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::upr::_Void_default_instance_),
-};
-
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  ::google::protobuf::MessageFactory* factory = NULL;
-  AssignDescriptors(
-      "upr.proto", schemas, file_default_instances, TableStruct::offsets, factory,
-      file_level_metadata, file_level_enum_descriptors, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 6);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\tupr.proto\022\003upr\032\037google/protobuf/timest"
-      "amp.proto\"\"\n\005Shape\022\014\n\004rank\030\001 \001(\005\022\013\n\003dim\030"
-      "\002 \003(\005\"\325\001\n\005Layer\022\n\n\002id\030\001 \001(\t\022\014\n\004name\030\002 \001("
-      "\t\022\031\n\005shape\030\003 \001(\0132\n.upr.Shape\022\022\n\nbyte_cou"
-      "nt\030\004 \001(\003\022\022\n\nipc_handle\030\005 \001(\014\022\026\n\016device_r"
-      "aw_ptr\030\006 \001(\003\022\021\n\tref_count\030\007 \001(\003\022\016\n\006offse"
-      "t\030\010 \001(\003\0224\n\023sharing_granularity\030\t \001(\0162\027.u"
-      "pr.SharingGranularity\"\343\001\n\013ModelHandle\022\n\n"
-      "\002id\030\001 \001(\t\022\014\n\004name\030\002 \001(\t\022\020\n\010model_id\030\003 \001("
-      "\t\022\022\n\nbyte_count\030\004 \001(\003\022\031\n\005layer\030\005 \003(\0132\n.u"
-      "pr.Layer\022\027\n\017needed_eviction\030\006 \001(\010\0224\n\023sha"
-      "ring_granularity\030\007 \001(\0162\027.upr.SharingGran"
-      "ularity\022\026\n\016device_raw_ptr\030\010 \001(\003\022\022\n\nipc_h"
-      "andle\030\t \001(\014\"\247\002\n\005Model\022\n\n\002id\030\001 \001(\t\022\014\n\004nam"
-      "e\030\002 \001(\t\022\021\n\tfile_path\030\003 \001(\t\022\021\n\tref_count\030"
-      "\004 \001(\003\022%\n\013owned_model\030\005 \001(\0132\020.upr.ModelHa"
-      "ndle\022&\n\014shared_model\030\006 \003(\0132\020.upr.ModelHa"
-      "ndle\0221\n\rlru_timestamp\030\007 \001(\0132\032.google.pro"
-      "tobuf.Timestamp\022\022\n\nfifo_order\030\010 \001(\003\022/\n\013u"
-      "se_history\030\t \003(\0132\032.google.protobuf.Times"
-      "tamp\022\027\n\017always_resident\030\n \001(\010\"|\n\014ModelRe"
-      "quest\022\014\n\004name\030\001 \001(\t\022\026\n\016directory_path\030\002 "
-      "\001(\t\022\020\n\010no_cache\030\003 \001(\010\0224\n\023sharing_granula"
-      "rity\030\004 \001(\0162\027.upr.SharingGranularity\"\006\n\004V"
-      "oid*m\n\022SharingGranularity\022\033\n\027SharingGran"
-      "ularity_Slab\020\000\022\034\n\030SharingGranularity_Lay"
-      "er\020\001\022\034\n\030SharingGranularity_Model\020\0022\212\001\n\010R"
-      "egistry\022-\n\004Open\022\021.upr.ModelRequest\032\020.upr"
-      ".ModelHandle\"\000\022&\n\005Close\022\020.upr.ModelHandl"
-      "e\032\t.upr.Void\"\000\022\'\n\004Info\022\021.upr.ModelReques"
-      "t\032\n.upr.Model\"\000B\010Z\003upr\370\001\001b\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1233);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "upr.proto", &protobuf_RegisterTypes);
-  ::protobuf_google_2fprotobuf_2ftimestamp_2eproto::AddDescriptors();
-}
-
-void AddDescriptors() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_upr_2eproto
-namespace upr {
-const ::google::protobuf::EnumDescriptor* SharingGranularity_descriptor() {
-  protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_upr_2eproto::file_level_enum_descriptors[0];
-}
-bool SharingGranularity_IsValid(int value) {
-  switch (value) {
-    case 0:
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
-  }
-}
-
-
-// ===================================================================
-
-void Shape::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Shape::kRankFieldNumber;
-const int Shape::kDimFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Shape::Shape()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_upr_2eproto::InitDefaultsShape();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:upr.Shape)
-}
-Shape::Shape(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  dim_(arena) {
-  ::protobuf_upr_2eproto::InitDefaultsShape();
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:upr.Shape)
-}
-Shape::Shape(const Shape& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      dim_(from.dim_),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  rank_ = from.rank_;
-  // @@protoc_insertion_point(copy_constructor:upr.Shape)
-}
-
-void Shape::SharedCtor() {
-  rank_ = 0;
-  _cached_size_ = 0;
-}
-
-Shape::~Shape() {
-  // @@protoc_insertion_point(destructor:upr.Shape)
-  SharedDtor();
-}
-
-void Shape::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() == NULL);
-}
-
-void Shape::ArenaDtor(void* object) {
-  Shape* _this = reinterpret_cast< Shape* >(object);
-  (void)_this;
-}
-void Shape::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void Shape::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Shape::descriptor() {
-  ::protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Shape& Shape::default_instance() {
-  ::protobuf_upr_2eproto::InitDefaultsShape();
-  return *internal_default_instance();
-}
-
-Shape* Shape::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<Shape>(arena);
-}
-
-void Shape::Clear() {
-// @@protoc_insertion_point(message_clear_start:upr.Shape)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  dim_.Clear();
-  rank_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool Shape::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:upr.Shape)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 rank = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &rank_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated int32 dim = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, this->mutable_dim())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 1, 18u, input, this->mutable_dim())));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:upr.Shape)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:upr.Shape)
-  return false;
-#undef DO_
-}
-
-void Shape::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:upr.Shape)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 rank = 1;
-  if (this->rank() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->rank(), output);
-  }
-
-  // repeated int32 dim = 2;
-  if (this->dim_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _dim_cached_byte_size_));
-  }
-  for (int i = 0, n = this->dim_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
-      this->dim(i), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:upr.Shape)
-}
-
-::google::protobuf::uint8* Shape::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:upr.Shape)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 rank = 1;
-  if (this->rank() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->rank(), target);
-  }
-
-  // repeated int32 dim = 2;
-  if (this->dim_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _dim_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteInt32NoTagToArray(this->dim_, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:upr.Shape)
-  return target;
-}
-
-size_t Shape::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:upr.Shape)
-  size_t total_size = 0;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // repeated int32 dim = 2;
-  {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      Int32Size(this->dim_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
-    }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _dim_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
-    total_size += data_size;
-  }
-
-  // int32 rank = 1;
-  if (this->rank() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->rank());
-  }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Shape::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:upr.Shape)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Shape* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Shape>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:upr.Shape)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:upr.Shape)
-    MergeFrom(*source);
-  }
-}
-
-void Shape::MergeFrom(const Shape& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:upr.Shape)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  dim_.MergeFrom(from.dim_);
-  if (from.rank() != 0) {
-    set_rank(from.rank());
-  }
-}
-
-void Shape::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:upr.Shape)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Shape::CopyFrom(const Shape& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:upr.Shape)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Shape::IsInitialized() const {
-  return true;
-}
-
-void Shape::Swap(Shape* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    Shape* temp = New(GetArenaNoVirtual());
-    temp->MergeFrom(*other);
-    other->CopyFrom(*this);
-    InternalSwap(temp);
-    if (GetArenaNoVirtual() == NULL) {
-      delete temp;
-    }
-  }
-}
-void Shape::UnsafeArenaSwap(Shape* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
-void Shape::InternalSwap(Shape* other) {
-  using std::swap;
-  dim_.InternalSwap(&other->dim_);
-  swap(rank_, other->rank_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Shape::GetMetadata() const {
-  protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
-// ===================================================================
-
-void Layer::InitAsDefaultInstance() {
-  ::upr::_Layer_default_instance_._instance.get_mutable()->shape_ = const_cast< ::upr::Shape*>(
-      ::upr::Shape::internal_default_instance());
-}
-void Layer::_slow_mutable_shape() {
-  shape_ = ::google::protobuf::Arena::CreateMessage< ::upr::Shape >(
-      GetArenaNoVirtual());
-}
-void Layer::unsafe_arena_set_allocated_shape(
-    ::upr::Shape* shape) {
-  if (GetArenaNoVirtual() == NULL) {
-    delete shape_;
-  }
-  shape_ = shape;
-  if (shape) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:upr.Layer.shape)
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Layer::kIdFieldNumber;
-const int Layer::kNameFieldNumber;
-const int Layer::kShapeFieldNumber;
-const int Layer::kByteCountFieldNumber;
-const int Layer::kIpcHandleFieldNumber;
-const int Layer::kDeviceRawPtrFieldNumber;
-const int Layer::kRefCountFieldNumber;
-const int Layer::kOffsetFieldNumber;
-const int Layer::kSharingGranularityFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Layer::Layer()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_upr_2eproto::InitDefaultsLayer();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:upr.Layer)
-}
-Layer::Layer(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena) {
-  ::protobuf_upr_2eproto::InitDefaultsLayer();
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:upr.Layer)
-}
-Layer::Layer(const Layer& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.id().size() > 0) {
-    id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.id(),
-      GetArenaNoVirtual());
-  }
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
-      GetArenaNoVirtual());
-  }
-  ipc_handle_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.ipc_handle().size() > 0) {
-    ipc_handle_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ipc_handle(),
-      GetArenaNoVirtual());
-  }
-  if (from.has_shape()) {
-    shape_ = new ::upr::Shape(*from.shape_);
-  } else {
-    shape_ = NULL;
-  }
-  ::memcpy(&byte_count_, &from.byte_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&sharing_granularity_) -
-    reinterpret_cast<char*>(&byte_count_)) + sizeof(sharing_granularity_));
-  // @@protoc_insertion_point(copy_constructor:upr.Layer)
-}
-
-void Layer::SharedCtor() {
-  id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ipc_handle_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&shape_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&sharing_granularity_) -
-      reinterpret_cast<char*>(&shape_)) + sizeof(sharing_granularity_));
-  _cached_size_ = 0;
-}
-
-Layer::~Layer() {
-  // @@protoc_insertion_point(destructor:upr.Layer)
-  SharedDtor();
-}
-
-void Layer::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() == NULL);
-  id_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ipc_handle_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete shape_;
-}
-
-void Layer::ArenaDtor(void* object) {
-  Layer* _this = reinterpret_cast< Layer* >(object);
-  (void)_this;
-}
-void Layer::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void Layer::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Layer::descriptor() {
-  ::protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Layer& Layer::default_instance() {
-  ::protobuf_upr_2eproto::InitDefaultsLayer();
-  return *internal_default_instance();
-}
-
-Layer* Layer::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<Layer>(arena);
-}
-
-void Layer::Clear() {
-// @@protoc_insertion_point(message_clear_start:upr.Layer)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  id_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  ipc_handle_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  if (GetArenaNoVirtual() == NULL && shape_ != NULL) {
-    delete shape_;
-  }
-  shape_ = NULL;
-  ::memset(&byte_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&sharing_granularity_) -
-      reinterpret_cast<char*>(&byte_count_)) + sizeof(sharing_granularity_));
-  _internal_metadata_.Clear();
-}
-
-bool Layer::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:upr.Layer)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_id()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->id().data(), static_cast<int>(this->id().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.Layer.id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string name = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.Layer.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .upr.Shape shape = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_shape()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 byte_count = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &byte_count_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bytes ipc_handle = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_ipc_handle()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 device_raw_ptr = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &device_raw_ptr_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 ref_count = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &ref_count_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 offset = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &offset_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .upr.SharingGranularity sharing_granularity = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_sharing_granularity(static_cast< ::upr::SharingGranularity >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:upr.Layer)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:upr.Layer)
-  return false;
-#undef DO_
-}
-
-void Layer::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:upr.Layer)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string id = 1;
-  if (this->id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->id().data(), static_cast<int>(this->id().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Layer.id");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->id(), output);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Layer.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
-  }
-
-  // .upr.Shape shape = 3;
-  if (this->has_shape()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->shape_, output);
-  }
-
-  // int64 byte_count = 4;
-  if (this->byte_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(4, this->byte_count(), output);
-  }
-
-  // bytes ipc_handle = 5;
-  if (this->ipc_handle().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      5, this->ipc_handle(), output);
-  }
-
-  // int64 device_raw_ptr = 6;
-  if (this->device_raw_ptr() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(6, this->device_raw_ptr(), output);
-  }
-
-  // int64 ref_count = 7;
-  if (this->ref_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(7, this->ref_count(), output);
-  }
-
-  // int64 offset = 8;
-  if (this->offset() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(8, this->offset(), output);
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 9;
-  if (this->sharing_granularity() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      9, this->sharing_granularity(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:upr.Layer)
-}
-
-::google::protobuf::uint8* Layer::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:upr.Layer)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string id = 1;
-  if (this->id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->id().data(), static_cast<int>(this->id().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Layer.id");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->id(), target);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Layer.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
-  }
-
-  // .upr.Shape shape = 3;
-  if (this->has_shape()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, *this->shape_, deterministic, target);
-  }
-
-  // int64 byte_count = 4;
-  if (this->byte_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(4, this->byte_count(), target);
-  }
-
-  // bytes ipc_handle = 5;
-  if (this->ipc_handle().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        5, this->ipc_handle(), target);
-  }
-
-  // int64 device_raw_ptr = 6;
-  if (this->device_raw_ptr() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(6, this->device_raw_ptr(), target);
-  }
-
-  // int64 ref_count = 7;
-  if (this->ref_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(7, this->ref_count(), target);
-  }
-
-  // int64 offset = 8;
-  if (this->offset() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(8, this->offset(), target);
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 9;
-  if (this->sharing_granularity() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      9, this->sharing_granularity(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:upr.Layer)
-  return target;
-}
-
-size_t Layer::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:upr.Layer)
-  size_t total_size = 0;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // string id = 1;
-  if (this->id().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->id());
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
-  }
-
-  // bytes ipc_handle = 5;
-  if (this->ipc_handle().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->ipc_handle());
-  }
-
-  // .upr.Shape shape = 3;
-  if (this->has_shape()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *this->shape_);
-  }
-
-  // int64 byte_count = 4;
-  if (this->byte_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->byte_count());
-  }
-
-  // int64 device_raw_ptr = 6;
-  if (this->device_raw_ptr() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->device_raw_ptr());
-  }
-
-  // int64 ref_count = 7;
-  if (this->ref_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->ref_count());
-  }
-
-  // int64 offset = 8;
-  if (this->offset() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->offset());
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 9;
-  if (this->sharing_granularity() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->sharing_granularity());
-  }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Layer::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:upr.Layer)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Layer* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Layer>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:upr.Layer)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:upr.Layer)
-    MergeFrom(*source);
-  }
-}
-
-void Layer::MergeFrom(const Layer& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:upr.Layer)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.id().size() > 0) {
-    set_id(from.id());
-  }
-  if (from.name().size() > 0) {
-    set_name(from.name());
-  }
-  if (from.ipc_handle().size() > 0) {
-    set_ipc_handle(from.ipc_handle());
-  }
-  if (from.has_shape()) {
-    mutable_shape()->::upr::Shape::MergeFrom(from.shape());
-  }
-  if (from.byte_count() != 0) {
-    set_byte_count(from.byte_count());
-  }
-  if (from.device_raw_ptr() != 0) {
-    set_device_raw_ptr(from.device_raw_ptr());
-  }
-  if (from.ref_count() != 0) {
-    set_ref_count(from.ref_count());
-  }
-  if (from.offset() != 0) {
-    set_offset(from.offset());
-  }
-  if (from.sharing_granularity() != 0) {
-    set_sharing_granularity(from.sharing_granularity());
-  }
-}
-
-void Layer::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:upr.Layer)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Layer::CopyFrom(const Layer& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:upr.Layer)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Layer::IsInitialized() const {
-  return true;
-}
-
-void Layer::Swap(Layer* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    Layer* temp = New(GetArenaNoVirtual());
-    temp->MergeFrom(*other);
-    other->CopyFrom(*this);
-    InternalSwap(temp);
-    if (GetArenaNoVirtual() == NULL) {
-      delete temp;
-    }
-  }
-}
-void Layer::UnsafeArenaSwap(Layer* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
-void Layer::InternalSwap(Layer* other) {
-  using std::swap;
-  id_.Swap(&other->id_);
-  name_.Swap(&other->name_);
-  ipc_handle_.Swap(&other->ipc_handle_);
-  swap(shape_, other->shape_);
-  swap(byte_count_, other->byte_count_);
-  swap(device_raw_ptr_, other->device_raw_ptr_);
-  swap(ref_count_, other->ref_count_);
-  swap(offset_, other->offset_);
-  swap(sharing_granularity_, other->sharing_granularity_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Layer::GetMetadata() const {
-  protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
-// ===================================================================
-
-void ModelHandle::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ModelHandle::kIdFieldNumber;
-const int ModelHandle::kNameFieldNumber;
-const int ModelHandle::kModelIdFieldNumber;
-const int ModelHandle::kByteCountFieldNumber;
-const int ModelHandle::kLayerFieldNumber;
-const int ModelHandle::kNeededEvictionFieldNumber;
-const int ModelHandle::kSharingGranularityFieldNumber;
-const int ModelHandle::kDeviceRawPtrFieldNumber;
-const int ModelHandle::kIpcHandleFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ModelHandle::ModelHandle()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_upr_2eproto::InitDefaultsModelHandle();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:upr.ModelHandle)
-}
-ModelHandle::ModelHandle(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  layer_(arena) {
-  ::protobuf_upr_2eproto::InitDefaultsModelHandle();
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:upr.ModelHandle)
-}
-ModelHandle::ModelHandle(const ModelHandle& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      layer_(from.layer_),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.id().size() > 0) {
-    id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.id(),
-      GetArenaNoVirtual());
-  }
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
-      GetArenaNoVirtual());
-  }
-  model_id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.model_id().size() > 0) {
-    model_id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.model_id(),
-      GetArenaNoVirtual());
-  }
-  ipc_handle_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.ipc_handle().size() > 0) {
-    ipc_handle_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ipc_handle(),
-      GetArenaNoVirtual());
-  }
-  ::memcpy(&byte_count_, &from.byte_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&device_raw_ptr_) -
-    reinterpret_cast<char*>(&byte_count_)) + sizeof(device_raw_ptr_));
-  // @@protoc_insertion_point(copy_constructor:upr.ModelHandle)
-}
-
-void ModelHandle::SharedCtor() {
-  id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  model_id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ipc_handle_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&byte_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&device_raw_ptr_) -
-      reinterpret_cast<char*>(&byte_count_)) + sizeof(device_raw_ptr_));
-  _cached_size_ = 0;
-}
-
-ModelHandle::~ModelHandle() {
-  // @@protoc_insertion_point(destructor:upr.ModelHandle)
-  SharedDtor();
-}
-
-void ModelHandle::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() == NULL);
-  id_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  model_id_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ipc_handle_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-void ModelHandle::ArenaDtor(void* object) {
-  ModelHandle* _this = reinterpret_cast< ModelHandle* >(object);
-  (void)_this;
-}
-void ModelHandle::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void ModelHandle::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ModelHandle::descriptor() {
-  ::protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const ModelHandle& ModelHandle::default_instance() {
-  ::protobuf_upr_2eproto::InitDefaultsModelHandle();
-  return *internal_default_instance();
-}
-
-ModelHandle* ModelHandle::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<ModelHandle>(arena);
-}
-
-void ModelHandle::Clear() {
-// @@protoc_insertion_point(message_clear_start:upr.ModelHandle)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  layer_.Clear();
-  id_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  model_id_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  ipc_handle_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  ::memset(&byte_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&device_raw_ptr_) -
-      reinterpret_cast<char*>(&byte_count_)) + sizeof(device_raw_ptr_));
-  _internal_metadata_.Clear();
-}
-
-bool ModelHandle::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:upr.ModelHandle)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_id()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->id().data(), static_cast<int>(this->id().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.ModelHandle.id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string name = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.ModelHandle.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string model_id = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_model_id()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->model_id().data(), static_cast<int>(this->model_id().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.ModelHandle.model_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 byte_count = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &byte_count_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .upr.Layer layer = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_layer()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool needed_eviction = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &needed_eviction_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .upr.SharingGranularity sharing_granularity = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_sharing_granularity(static_cast< ::upr::SharingGranularity >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 device_raw_ptr = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &device_raw_ptr_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bytes ipc_handle = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(74u /* 74 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_ipc_handle()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:upr.ModelHandle)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:upr.ModelHandle)
-  return false;
-#undef DO_
-}
-
-void ModelHandle::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:upr.ModelHandle)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string id = 1;
-  if (this->id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->id().data(), static_cast<int>(this->id().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelHandle.id");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->id(), output);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelHandle.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
-  }
-
-  // string model_id = 3;
-  if (this->model_id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->model_id().data(), static_cast<int>(this->model_id().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelHandle.model_id");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->model_id(), output);
-  }
-
-  // int64 byte_count = 4;
-  if (this->byte_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(4, this->byte_count(), output);
-  }
-
-  // repeated .upr.Layer layer = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->layer_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->layer(static_cast<int>(i)), output);
-  }
-
-  // bool needed_eviction = 6;
-  if (this->needed_eviction() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->needed_eviction(), output);
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 7;
-  if (this->sharing_granularity() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      7, this->sharing_granularity(), output);
-  }
-
-  // int64 device_raw_ptr = 8;
-  if (this->device_raw_ptr() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(8, this->device_raw_ptr(), output);
-  }
-
-  // bytes ipc_handle = 9;
-  if (this->ipc_handle().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      9, this->ipc_handle(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:upr.ModelHandle)
-}
-
-::google::protobuf::uint8* ModelHandle::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:upr.ModelHandle)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string id = 1;
-  if (this->id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->id().data(), static_cast<int>(this->id().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelHandle.id");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->id(), target);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelHandle.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
-  }
-
-  // string model_id = 3;
-  if (this->model_id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->model_id().data(), static_cast<int>(this->model_id().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelHandle.model_id");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->model_id(), target);
-  }
-
-  // int64 byte_count = 4;
-  if (this->byte_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(4, this->byte_count(), target);
-  }
-
-  // repeated .upr.Layer layer = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->layer_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        5, this->layer(static_cast<int>(i)), deterministic, target);
-  }
-
-  // bool needed_eviction = 6;
-  if (this->needed_eviction() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->needed_eviction(), target);
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 7;
-  if (this->sharing_granularity() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      7, this->sharing_granularity(), target);
-  }
-
-  // int64 device_raw_ptr = 8;
-  if (this->device_raw_ptr() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(8, this->device_raw_ptr(), target);
-  }
-
-  // bytes ipc_handle = 9;
-  if (this->ipc_handle().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        9, this->ipc_handle(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:upr.ModelHandle)
-  return target;
-}
-
-size_t ModelHandle::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:upr.ModelHandle)
-  size_t total_size = 0;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // repeated .upr.Layer layer = 5;
-  {
-    unsigned int count = static_cast<unsigned int>(this->layer_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->layer(static_cast<int>(i)));
-    }
-  }
-
-  // string id = 1;
-  if (this->id().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->id());
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
-  }
-
-  // string model_id = 3;
-  if (this->model_id().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->model_id());
-  }
-
-  // bytes ipc_handle = 9;
-  if (this->ipc_handle().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->ipc_handle());
-  }
-
-  // int64 byte_count = 4;
-  if (this->byte_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->byte_count());
-  }
-
-  // bool needed_eviction = 6;
-  if (this->needed_eviction() != 0) {
-    total_size += 1 + 1;
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 7;
-  if (this->sharing_granularity() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->sharing_granularity());
-  }
-
-  // int64 device_raw_ptr = 8;
-  if (this->device_raw_ptr() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->device_raw_ptr());
-  }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void ModelHandle::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:upr.ModelHandle)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ModelHandle* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ModelHandle>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:upr.ModelHandle)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:upr.ModelHandle)
-    MergeFrom(*source);
-  }
-}
-
-void ModelHandle::MergeFrom(const ModelHandle& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:upr.ModelHandle)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  layer_.MergeFrom(from.layer_);
-  if (from.id().size() > 0) {
-    set_id(from.id());
-  }
-  if (from.name().size() > 0) {
-    set_name(from.name());
-  }
-  if (from.model_id().size() > 0) {
-    set_model_id(from.model_id());
-  }
-  if (from.ipc_handle().size() > 0) {
-    set_ipc_handle(from.ipc_handle());
-  }
-  if (from.byte_count() != 0) {
-    set_byte_count(from.byte_count());
-  }
-  if (from.needed_eviction() != 0) {
-    set_needed_eviction(from.needed_eviction());
-  }
-  if (from.sharing_granularity() != 0) {
-    set_sharing_granularity(from.sharing_granularity());
-  }
-  if (from.device_raw_ptr() != 0) {
-    set_device_raw_ptr(from.device_raw_ptr());
-  }
-}
-
-void ModelHandle::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:upr.ModelHandle)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void ModelHandle::CopyFrom(const ModelHandle& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:upr.ModelHandle)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool ModelHandle::IsInitialized() const {
-  return true;
-}
-
-void ModelHandle::Swap(ModelHandle* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    ModelHandle* temp = New(GetArenaNoVirtual());
-    temp->MergeFrom(*other);
-    other->CopyFrom(*this);
-    InternalSwap(temp);
-    if (GetArenaNoVirtual() == NULL) {
-      delete temp;
-    }
-  }
-}
-void ModelHandle::UnsafeArenaSwap(ModelHandle* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
-void ModelHandle::InternalSwap(ModelHandle* other) {
-  using std::swap;
-  layer_.InternalSwap(&other->layer_);
-  id_.Swap(&other->id_);
-  name_.Swap(&other->name_);
-  model_id_.Swap(&other->model_id_);
-  ipc_handle_.Swap(&other->ipc_handle_);
-  swap(byte_count_, other->byte_count_);
-  swap(needed_eviction_, other->needed_eviction_);
-  swap(sharing_granularity_, other->sharing_granularity_);
-  swap(device_raw_ptr_, other->device_raw_ptr_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata ModelHandle::GetMetadata() const {
-  protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
-// ===================================================================
-
-void Model::InitAsDefaultInstance() {
-  ::upr::_Model_default_instance_._instance.get_mutable()->owned_model_ = const_cast< ::upr::ModelHandle*>(
-      ::upr::ModelHandle::internal_default_instance());
-  ::upr::_Model_default_instance_._instance.get_mutable()->lru_timestamp_ = const_cast< ::google::protobuf::Timestamp*>(
-      ::google::protobuf::Timestamp::internal_default_instance());
-}
-void Model::_slow_mutable_owned_model() {
-  owned_model_ = ::google::protobuf::Arena::CreateMessage< ::upr::ModelHandle >(
-      GetArenaNoVirtual());
-}
-void Model::unsafe_arena_set_allocated_owned_model(
-    ::upr::ModelHandle* owned_model) {
-  if (GetArenaNoVirtual() == NULL) {
-    delete owned_model_;
-  }
-  owned_model_ = owned_model;
-  if (owned_model) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:upr.Model.owned_model)
-}
-void Model::_slow_mutable_lru_timestamp() {
-  lru_timestamp_ = ::google::protobuf::Arena::CreateMessage< ::google::protobuf::Timestamp >(
-      GetArenaNoVirtual());
-}
-void Model::unsafe_arena_set_allocated_lru_timestamp(
-    ::google::protobuf::Timestamp* lru_timestamp) {
-  if (GetArenaNoVirtual() == NULL) {
-    delete lru_timestamp_;
-  }
-  lru_timestamp_ = lru_timestamp;
-  if (lru_timestamp) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:upr.Model.lru_timestamp)
-}
-void Model::clear_lru_timestamp() {
-  if (GetArenaNoVirtual() == NULL && lru_timestamp_ != NULL) {
-    delete lru_timestamp_;
-  }
-  lru_timestamp_ = NULL;
-}
-void Model::clear_use_history() {
-  use_history_.Clear();
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Model::kIdFieldNumber;
-const int Model::kNameFieldNumber;
-const int Model::kFilePathFieldNumber;
-const int Model::kRefCountFieldNumber;
-const int Model::kOwnedModelFieldNumber;
-const int Model::kSharedModelFieldNumber;
-const int Model::kLruTimestampFieldNumber;
-const int Model::kFifoOrderFieldNumber;
-const int Model::kUseHistoryFieldNumber;
-const int Model::kAlwaysResidentFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Model::Model()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_upr_2eproto::InitDefaultsModel();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:upr.Model)
-}
-Model::Model(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  shared_model_(arena),
-  use_history_(arena) {
-  ::protobuf_upr_2eproto::InitDefaultsModel();
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:upr.Model)
-}
-Model::Model(const Model& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      shared_model_(from.shared_model_),
-      use_history_(from.use_history_),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.id().size() > 0) {
-    id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.id(),
-      GetArenaNoVirtual());
-  }
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
-      GetArenaNoVirtual());
-  }
-  file_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.file_path().size() > 0) {
-    file_path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.file_path(),
-      GetArenaNoVirtual());
-  }
-  if (from.has_owned_model()) {
-    owned_model_ = new ::upr::ModelHandle(*from.owned_model_);
-  } else {
-    owned_model_ = NULL;
-  }
-  if (from.has_lru_timestamp()) {
-    lru_timestamp_ = new ::google::protobuf::Timestamp(*from.lru_timestamp_);
-  } else {
-    lru_timestamp_ = NULL;
-  }
-  ::memcpy(&ref_count_, &from.ref_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&always_resident_) -
-    reinterpret_cast<char*>(&ref_count_)) + sizeof(always_resident_));
-  // @@protoc_insertion_point(copy_constructor:upr.Model)
-}
-
-void Model::SharedCtor() {
-  id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  file_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&owned_model_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&always_resident_) -
-      reinterpret_cast<char*>(&owned_model_)) + sizeof(always_resident_));
-  _cached_size_ = 0;
-}
-
-Model::~Model() {
-  // @@protoc_insertion_point(destructor:upr.Model)
-  SharedDtor();
-}
-
-void Model::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() == NULL);
-  id_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  file_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete owned_model_;
-  if (this != internal_default_instance()) delete lru_timestamp_;
-}
-
-void Model::ArenaDtor(void* object) {
-  Model* _this = reinterpret_cast< Model* >(object);
-  (void)_this;
-}
-void Model::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void Model::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Model::descriptor() {
-  ::protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Model& Model::default_instance() {
-  ::protobuf_upr_2eproto::InitDefaultsModel();
-  return *internal_default_instance();
-}
-
-Model* Model::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<Model>(arena);
-}
-
-void Model::Clear() {
-// @@protoc_insertion_point(message_clear_start:upr.Model)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  shared_model_.Clear();
-  use_history_.Clear();
-  id_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  file_path_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  if (GetArenaNoVirtual() == NULL && owned_model_ != NULL) {
-    delete owned_model_;
-  }
-  owned_model_ = NULL;
-  if (GetArenaNoVirtual() == NULL && lru_timestamp_ != NULL) {
-    delete lru_timestamp_;
-  }
-  lru_timestamp_ = NULL;
-  ::memset(&ref_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&always_resident_) -
-      reinterpret_cast<char*>(&ref_count_)) + sizeof(always_resident_));
-  _internal_metadata_.Clear();
-}
-
-bool Model::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:upr.Model)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_id()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->id().data(), static_cast<int>(this->id().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.Model.id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string name = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.Model.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string file_path = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_file_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->file_path().data(), static_cast<int>(this->file_path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.Model.file_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 ref_count = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &ref_count_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .upr.ModelHandle owned_model = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_owned_model()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .upr.ModelHandle shared_model = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_shared_model()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .google.protobuf.Timestamp lru_timestamp = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_lru_timestamp()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int64 fifo_order = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &fifo_order_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .google.protobuf.Timestamp use_history = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(74u /* 74 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_use_history()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool always_resident = 10;
-      case 10: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &always_resident_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:upr.Model)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:upr.Model)
-  return false;
-#undef DO_
-}
-
-void Model::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:upr.Model)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string id = 1;
-  if (this->id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->id().data(), static_cast<int>(this->id().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Model.id");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->id(), output);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Model.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
-  }
-
-  // string file_path = 3;
-  if (this->file_path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->file_path().data(), static_cast<int>(this->file_path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Model.file_path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->file_path(), output);
-  }
-
-  // int64 ref_count = 4;
-  if (this->ref_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(4, this->ref_count(), output);
-  }
-
-  // .upr.ModelHandle owned_model = 5;
-  if (this->has_owned_model()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, *this->owned_model_, output);
-  }
-
-  // repeated .upr.ModelHandle shared_model = 6;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->shared_model_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->shared_model(static_cast<int>(i)), output);
-  }
-
-  // .google.protobuf.Timestamp lru_timestamp = 7;
-  if (this->has_lru_timestamp()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, *this->lru_timestamp_, output);
-  }
-
-  // int64 fifo_order = 8;
-  if (this->fifo_order() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(8, this->fifo_order(), output);
-  }
-
-  // repeated .google.protobuf.Timestamp use_history = 9;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->use_history_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      9, this->use_history(static_cast<int>(i)), output);
-  }
-
-  // bool always_resident = 10;
-  if (this->always_resident() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(10, this->always_resident(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:upr.Model)
-}
-
-::google::protobuf::uint8* Model::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:upr.Model)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string id = 1;
-  if (this->id().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->id().data(), static_cast<int>(this->id().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Model.id");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->id(), target);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Model.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
-  }
-
-  // string file_path = 3;
-  if (this->file_path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->file_path().data(), static_cast<int>(this->file_path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.Model.file_path");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->file_path(), target);
-  }
-
-  // int64 ref_count = 4;
-  if (this->ref_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(4, this->ref_count(), target);
-  }
-
-  // .upr.ModelHandle owned_model = 5;
-  if (this->has_owned_model()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        5, *this->owned_model_, deterministic, target);
-  }
-
-  // repeated .upr.ModelHandle shared_model = 6;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->shared_model_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        6, this->shared_model(static_cast<int>(i)), deterministic, target);
-  }
-
-  // .google.protobuf.Timestamp lru_timestamp = 7;
-  if (this->has_lru_timestamp()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        7, *this->lru_timestamp_, deterministic, target);
-  }
-
-  // int64 fifo_order = 8;
-  if (this->fifo_order() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(8, this->fifo_order(), target);
-  }
-
-  // repeated .google.protobuf.Timestamp use_history = 9;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->use_history_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        9, this->use_history(static_cast<int>(i)), deterministic, target);
-  }
-
-  // bool always_resident = 10;
-  if (this->always_resident() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(10, this->always_resident(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:upr.Model)
-  return target;
-}
-
-size_t Model::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:upr.Model)
-  size_t total_size = 0;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // repeated .upr.ModelHandle shared_model = 6;
-  {
-    unsigned int count = static_cast<unsigned int>(this->shared_model_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->shared_model(static_cast<int>(i)));
-    }
-  }
-
-  // repeated .google.protobuf.Timestamp use_history = 9;
-  {
-    unsigned int count = static_cast<unsigned int>(this->use_history_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->use_history(static_cast<int>(i)));
-    }
-  }
-
-  // string id = 1;
-  if (this->id().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->id());
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
-  }
-
-  // string file_path = 3;
-  if (this->file_path().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->file_path());
-  }
-
-  // .upr.ModelHandle owned_model = 5;
-  if (this->has_owned_model()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *this->owned_model_);
-  }
-
-  // .google.protobuf.Timestamp lru_timestamp = 7;
-  if (this->has_lru_timestamp()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *this->lru_timestamp_);
-  }
-
-  // int64 ref_count = 4;
-  if (this->ref_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->ref_count());
-  }
-
-  // int64 fifo_order = 8;
-  if (this->fifo_order() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->fifo_order());
-  }
-
-  // bool always_resident = 10;
-  if (this->always_resident() != 0) {
-    total_size += 1 + 1;
-  }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Model::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:upr.Model)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Model* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Model>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:upr.Model)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:upr.Model)
-    MergeFrom(*source);
-  }
-}
-
-void Model::MergeFrom(const Model& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:upr.Model)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  shared_model_.MergeFrom(from.shared_model_);
-  use_history_.MergeFrom(from.use_history_);
-  if (from.id().size() > 0) {
-    set_id(from.id());
-  }
-  if (from.name().size() > 0) {
-    set_name(from.name());
-  }
-  if (from.file_path().size() > 0) {
-    set_file_path(from.file_path());
-  }
-  if (from.has_owned_model()) {
-    mutable_owned_model()->::upr::ModelHandle::MergeFrom(from.owned_model());
-  }
-  if (from.has_lru_timestamp()) {
-    mutable_lru_timestamp()->::google::protobuf::Timestamp::MergeFrom(from.lru_timestamp());
-  }
-  if (from.ref_count() != 0) {
-    set_ref_count(from.ref_count());
-  }
-  if (from.fifo_order() != 0) {
-    set_fifo_order(from.fifo_order());
-  }
-  if (from.always_resident() != 0) {
-    set_always_resident(from.always_resident());
-  }
-}
-
-void Model::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:upr.Model)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Model::CopyFrom(const Model& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:upr.Model)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Model::IsInitialized() const {
-  return true;
-}
-
-void Model::Swap(Model* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    Model* temp = New(GetArenaNoVirtual());
-    temp->MergeFrom(*other);
-    other->CopyFrom(*this);
-    InternalSwap(temp);
-    if (GetArenaNoVirtual() == NULL) {
-      delete temp;
-    }
-  }
-}
-void Model::UnsafeArenaSwap(Model* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
-void Model::InternalSwap(Model* other) {
-  using std::swap;
-  shared_model_.InternalSwap(&other->shared_model_);
-  use_history_.InternalSwap(&other->use_history_);
-  id_.Swap(&other->id_);
-  name_.Swap(&other->name_);
-  file_path_.Swap(&other->file_path_);
-  swap(owned_model_, other->owned_model_);
-  swap(lru_timestamp_, other->lru_timestamp_);
-  swap(ref_count_, other->ref_count_);
-  swap(fifo_order_, other->fifo_order_);
-  swap(always_resident_, other->always_resident_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Model::GetMetadata() const {
-  protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
-// ===================================================================
-
-void ModelRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ModelRequest::kNameFieldNumber;
-const int ModelRequest::kDirectoryPathFieldNumber;
-const int ModelRequest::kNoCacheFieldNumber;
-const int ModelRequest::kSharingGranularityFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ModelRequest::ModelRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_upr_2eproto::InitDefaultsModelRequest();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:upr.ModelRequest)
-}
-ModelRequest::ModelRequest(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena) {
-  ::protobuf_upr_2eproto::InitDefaultsModelRequest();
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:upr.ModelRequest)
-}
-ModelRequest::ModelRequest(const ModelRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
-      GetArenaNoVirtual());
-  }
-  directory_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.directory_path().size() > 0) {
-    directory_path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.directory_path(),
-      GetArenaNoVirtual());
-  }
-  ::memcpy(&no_cache_, &from.no_cache_,
-    static_cast<size_t>(reinterpret_cast<char*>(&sharing_granularity_) -
-    reinterpret_cast<char*>(&no_cache_)) + sizeof(sharing_granularity_));
-  // @@protoc_insertion_point(copy_constructor:upr.ModelRequest)
-}
-
-void ModelRequest::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  directory_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&no_cache_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&sharing_granularity_) -
-      reinterpret_cast<char*>(&no_cache_)) + sizeof(sharing_granularity_));
-  _cached_size_ = 0;
-}
-
-ModelRequest::~ModelRequest() {
-  // @@protoc_insertion_point(destructor:upr.ModelRequest)
-  SharedDtor();
-}
-
-void ModelRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() == NULL);
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  directory_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
-void ModelRequest::ArenaDtor(void* object) {
-  ModelRequest* _this = reinterpret_cast< ModelRequest* >(object);
-  (void)_this;
-}
-void ModelRequest::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void ModelRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ModelRequest::descriptor() {
-  ::protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const ModelRequest& ModelRequest::default_instance() {
-  ::protobuf_upr_2eproto::InitDefaultsModelRequest();
-  return *internal_default_instance();
-}
-
-ModelRequest* ModelRequest::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<ModelRequest>(arena);
-}
-
-void ModelRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:upr.ModelRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  directory_path_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  ::memset(&no_cache_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&sharing_granularity_) -
-      reinterpret_cast<char*>(&no_cache_)) + sizeof(sharing_granularity_));
-  _internal_metadata_.Clear();
-}
-
-bool ModelRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:upr.ModelRequest)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.ModelRequest.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string directory_path = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_directory_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->directory_path().data(), static_cast<int>(this->directory_path().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "upr.ModelRequest.directory_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool no_cache = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &no_cache_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .upr.SharingGranularity sharing_granularity = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_sharing_granularity(static_cast< ::upr::SharingGranularity >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:upr.ModelRequest)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:upr.ModelRequest)
-  return false;
-#undef DO_
-}
-
-void ModelRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:upr.ModelRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelRequest.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // string directory_path = 2;
-  if (this->directory_path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->directory_path().data(), static_cast<int>(this->directory_path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelRequest.directory_path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->directory_path(), output);
-  }
-
-  // bool no_cache = 3;
-  if (this->no_cache() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->no_cache(), output);
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 4;
-  if (this->sharing_granularity() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      4, this->sharing_granularity(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:upr.ModelRequest)
-}
-
-::google::protobuf::uint8* ModelRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:upr.ModelRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelRequest.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-
-  // string directory_path = 2;
-  if (this->directory_path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->directory_path().data(), static_cast<int>(this->directory_path().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "upr.ModelRequest.directory_path");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->directory_path(), target);
-  }
-
-  // bool no_cache = 3;
-  if (this->no_cache() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->no_cache(), target);
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 4;
-  if (this->sharing_granularity() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      4, this->sharing_granularity(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:upr.ModelRequest)
-  return target;
-}
-
-size_t ModelRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:upr.ModelRequest)
-  size_t total_size = 0;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // string name = 1;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
-  }
-
-  // string directory_path = 2;
-  if (this->directory_path().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->directory_path());
-  }
-
-  // bool no_cache = 3;
-  if (this->no_cache() != 0) {
-    total_size += 1 + 1;
-  }
-
-  // .upr.SharingGranularity sharing_granularity = 4;
-  if (this->sharing_granularity() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->sharing_granularity());
-  }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void ModelRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:upr.ModelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ModelRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ModelRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:upr.ModelRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:upr.ModelRequest)
-    MergeFrom(*source);
-  }
-}
-
-void ModelRequest::MergeFrom(const ModelRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:upr.ModelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.name().size() > 0) {
-    set_name(from.name());
-  }
-  if (from.directory_path().size() > 0) {
-    set_directory_path(from.directory_path());
-  }
-  if (from.no_cache() != 0) {
-    set_no_cache(from.no_cache());
-  }
-  if (from.sharing_granularity() != 0) {
-    set_sharing_granularity(from.sharing_granularity());
-  }
-}
-
-void ModelRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:upr.ModelRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void ModelRequest::CopyFrom(const ModelRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:upr.ModelRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool ModelRequest::IsInitialized() const {
-  return true;
-}
-
-void ModelRequest::Swap(ModelRequest* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    ModelRequest* temp = New(GetArenaNoVirtual());
-    temp->MergeFrom(*other);
-    other->CopyFrom(*this);
-    InternalSwap(temp);
-    if (GetArenaNoVirtual() == NULL) {
-      delete temp;
-    }
-  }
-}
-void ModelRequest::UnsafeArenaSwap(ModelRequest* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
-void ModelRequest::InternalSwap(ModelRequest* other) {
-  using std::swap;
-  name_.Swap(&other->name_);
-  directory_path_.Swap(&other->directory_path_);
-  swap(no_cache_, other->no_cache_);
-  swap(sharing_granularity_, other->sharing_granularity_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata ModelRequest::GetMetadata() const {
-  protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
-// ===================================================================
-
-void Void::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Void::Void()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    ::protobuf_upr_2eproto::InitDefaultsVoid();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:upr.Void)
-}
-Void::Void(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena) {
-  ::protobuf_upr_2eproto::InitDefaultsVoid();
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:upr.Void)
-}
-Void::Void(const Void& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:upr.Void)
-}
-
-void Void::SharedCtor() {
-  _cached_size_ = 0;
-}
-
-Void::~Void() {
-  // @@protoc_insertion_point(destructor:upr.Void)
-  SharedDtor();
-}
-
-void Void::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() == NULL);
-}
-
-void Void::ArenaDtor(void* object) {
-  Void* _this = reinterpret_cast< Void* >(object);
-  (void)_this;
-}
-void Void::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void Void::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Void::descriptor() {
-  ::protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Void& Void::default_instance() {
-  ::protobuf_upr_2eproto::InitDefaultsVoid();
-  return *internal_default_instance();
-}
-
-Void* Void::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<Void>(arena);
-}
-
-void Void::Clear() {
-// @@protoc_insertion_point(message_clear_start:upr.Void)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _internal_metadata_.Clear();
-}
-
-bool Void::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:upr.Void)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, _internal_metadata_.mutable_unknown_fields()));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:upr.Void)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:upr.Void)
-  return false;
-#undef DO_
-}
-
-void Void::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:upr.Void)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:upr.Void)
-}
-
-::google::protobuf::uint8* Void::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:upr.Void)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:upr.Void)
-  return target;
-}
-
-size_t Void::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:upr.Void)
-  size_t total_size = 0;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Void::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:upr.Void)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Void* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Void>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:upr.Void)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:upr.Void)
-    MergeFrom(*source);
-  }
-}
-
-void Void::MergeFrom(const Void& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:upr.Void)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-}
-
-void Void::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:upr.Void)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Void::CopyFrom(const Void& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:upr.Void)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Void::IsInitialized() const {
-  return true;
-}
-
-void Void::Swap(Void* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    Void* temp = New(GetArenaNoVirtual());
-    temp->MergeFrom(*other);
-    other->CopyFrom(*this);
-    InternalSwap(temp);
-    if (GetArenaNoVirtual() == NULL) {
-      delete temp;
-    }
-  }
-}
-void Void::UnsafeArenaSwap(Void* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
-void Void::InternalSwap(Void* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Void::GetMetadata() const {
-  protobuf_upr_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_upr_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace upr
-
-// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace upr {
+
+// Coalesces concurrent single sample requests into batches.
+//
+// Callers block in predict while a worker thread collects requests until
+// either max_batch_size requests are queued or max_delay has passed since
+// the oldest queued request, and then runs them as one batch. The batch is
+// run by run_batch, which reads the inputs of the requests and writes their
+// outputs.
+class request_batcher {
+public:
+  struct request {
+    const float *input{nullptr};
+    float *output{nullptr};
+  };
+  using run_batch_fn = std::function<void(const std::vector<request> &)>;
+
+  request_batcher(size_t max_batch_size, std::chrono::microseconds max_delay, run_batch_fn run_batch)
+      : max_batch_size_(std::max<size_t>(max_batch_size, 1)), max_delay_(max_delay), run_batch_(std::move(run_batch)) {
+    worker_ = std::thread([this]() { work(); });
+  }
+
+  request_batcher(const request_batcher &) = delete;
+  request_batcher &operator=(const request_batcher &) = delete;
+
+  // pending requests are run before the worker stops
+  ~request_batcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    queued_.notify_all();
+    worker_.join();
+  }
+
+  // queues a request and waits for its batch to complete. throws a
+  // runtime_error if the batch failed
+  void predict(const float *input, float *output) {
+    pending p;
+    p.req.input  = input;
+    p.req.output = output;
+    p.queued_at  = clock::now();
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopping_) {
+      throw std::runtime_error("the batcher is stopping");
+    }
+    queue_.emplace_back(&p);
+    queued_.notify_all();
+    completed_.wait(lock, [&p]() { return p.done; });
+    if (!p.error.empty()) {
+      throw std::runtime_error(p.error);
+    }
+  }
+
+  size_t max_batch_size() const {
+    return max_batch_size_;
+  }
+
+  // the number of batches run and the number of requests they held
+  uint64_t num_batches() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_batches_;
+  }
+
+  uint64_t num_requests() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_requests_;
+  }
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  struct pending {
+    request req{};
+    clock::time_point queued_at{};
+    bool done{false};
+    std::string error{};
+  };
+
+  void work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      queued_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      // wait for a full batch, the deadline of the oldest request, or stop
+      const auto deadline = queue_.front()->queued_at + max_delay_;
+      queued_.wait_until(lock, deadline, [this]() { return stopping_ || queue_.size() >= max_batch_size_; });
+
+      const auto count = std::min(queue_.size(), max_batch_size_);
+      std::vector<pending *> batch(queue_.begin(), queue_.begin() + count);
+      queue_.erase(queue_.begin(), queue_.begin() + count);
+      num_batches_++;
+      num_requests_ += count;
+      lock.unlock();
+
+      std::vector<request> requests;
+      requests.reserve(batch.size());
+      for (const auto p : batch) {
+        requests.emplace_back(p->req);
+      }
+      std::string error{};
+      try {
+        run_batch_(requests);
+      } catch (const std::exception &e) {
+        error = e.what();
+        if (error.empty()) {
+          error = "the batch failed";
+        }
+      } catch (...) {
+        error = "the batch failed";
+      }
+
+      lock.lock();
+      for (auto p : batch) {
+        p->error = error;
+        p->done  = true;
+      }
+      completed_.notify_all();
+    }
+  }
+
+  const size_t max_batch_size_;
+  const std::chrono::microseconds max_delay_;
+  const run_batch_fn run_batch_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable queued_;
+  std::condition_variable completed_;
+  std::deque<pending *> queue_{};
+  bool stopping_{false};
+  uint64_t num_batches_{0};
+  uint64_t num_requests_{0};
+  std::thread worker_;
+};
+
+// the batch sizes an executor is prepared for: the powers of two below
+// max_batch_size, and max_batch_size
+static inline std::vector<size_t> to_prepared_batch_sizes(size_t max_batch_size) {
+  std::vector<size_t> res{};
+  for (size_t size = 1; size < max_batch_size; size *= 2) {
+    res.emplace_back(size);
+  }
+  res.emplace_back(std::max<size_t>(max_batch_size, 1));
+  return res;
+}
+
+// the smallest prepared batch size that fits count requests
+static inline size_t to_prepared_batch_size(const std::vector<size_t> &sizes, size_t count) {
+  const auto it = std::lower_bound(sizes.begin(), sizes.end(), count);
+  if (it == sizes.end()) {
+    throw std::runtime_error("no prepared batch size fits " + std::to_string(count) + " requests");
+  }
+  return *it;
+}
+
+} // namespace upr
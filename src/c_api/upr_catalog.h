@@ -0,0 +1,331 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <dirent.h>
+#include <fstream>
+#include <mutex>
+#include <poll.h>
+#include <shared_mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+namespace upr {
+
+struct catalog_entry {
+  std::string name{};
+  std::string directory_path{};
+  std::string params_path{};
+  std::string symbol_path{};
+  // size of the params file in bytes
+  size_t byte_count{0};
+  // the input shape declared in the manifest. empty if unknown
+  std::vector<int64_t> input_shape{};
+  // the checksum declared in the manifest. empty if unknown
+  std::string checksum{};
+};
+
+// The models that can be served, keyed by name.
+//
+// The catalog is built by scanning a base directory, where every sub
+// directory that holds a params and a symbol file is a model named after the
+// directory. A manifest can add models stored elsewhere and declare their
+// input shapes and checksums. Lookups are a single hash lookup, and the
+// catalog can be kept up to date with inotify while it is being served.
+class model_catalog {
+public:
+  ~model_catalog() {
+    stop_watching();
+  }
+
+  // replaces the scanned models with the content of base_directory. the
+  // models declared in the manifest are kept
+  void scan(const std::string &base_directory) {
+    std::unordered_map<std::string, catalog_entry> scanned;
+    for (const auto &name : list_directories(base_directory)) {
+      catalog_entry entry;
+      if (make_entry(name, join(base_directory, name), &entry)) {
+        scanned.emplace(name, entry);
+      }
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    base_directory_ = base_directory;
+    scanned_        = std::move(scanned);
+    rebuild();
+  }
+
+  // reads a manifest with one model per line
+  //   model_name,directory_path[,input_shape[,checksum]]
+  // where the input shape is formatted as 1x3x224x224. relative directories
+  // are resolved against the scanned base directory. lines starting with #
+  // are ignored
+  void load_manifest(const std::string &manifest_path) {
+    std::ifstream in(manifest_path);
+    if (!in.is_open()) {
+      throw std::runtime_error("unable to open the model manifest " + manifest_path);
+    }
+
+    std::unordered_map<std::string, catalog_entry> manifest;
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#') {
+        continue;
+      }
+      const auto fields = split(line, ',');
+      if (fields.size() < 2 || fields.size() > 4) {
+        throw std::runtime_error("invalid line in the model manifest " + manifest_path + ": " + line);
+      }
+      auto directory_path = fields[1];
+      if (!directory_path.empty() && directory_path[0] != '/') {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        directory_path = join(base_directory_, directory_path);
+      }
+      catalog_entry entry;
+      if (!make_entry(fields[0], directory_path, &entry)) {
+        throw std::runtime_error("the model " + fields[0] + " in the model manifest has no params or symbol file in " +
+                                 directory_path);
+      }
+      if (fields.size() > 2) {
+        for (const auto &dim : split(fields[2], 'x')) {
+          entry.input_shape.emplace_back(std::stoll(dim));
+        }
+      }
+      if (fields.size() > 3) {
+        entry.checksum = fields[3];
+      }
+      manifest.emplace(entry.name, entry);
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    manifest_path_ = manifest_path;
+    manifest_      = std::move(manifest);
+    rebuild();
+  }
+
+  bool find(const std::string &model_name, catalog_entry *entry) const {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    const auto it = entries_.find(model_name);
+    if (it == entries_.end()) {
+      return false;
+    }
+    *entry = it->second;
+    return true;
+  }
+
+  std::vector<std::string> names() const {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    std::vector<std::string> res;
+    for (const auto &kv : entries_) {
+      res.emplace_back(kv.first);
+    }
+    return res;
+  }
+
+  size_t size() const {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  // rescans the base directory (and reloads the manifest) whenever a model
+  // directory or the manifest changes
+  void watch() {
+    if (watching_) {
+      return;
+    }
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ == -1) {
+      throw std::runtime_error("unable to initialize inotify");
+    }
+    watching_ = true;
+    watcher_  = std::thread([this]() { watch_loop(); });
+  }
+
+  void stop_watching() {
+    if (!watching_) {
+      return;
+    }
+    watching_ = false;
+    watcher_.join();
+    close(inotify_fd_);
+    inotify_fd_ = -1;
+  }
+
+private:
+  static std::vector<std::string> split(const std::string &str, char delim) {
+    std::vector<std::string> res;
+    std::stringstream ss(str);
+    std::string item;
+    while (std::getline(ss, item, delim)) {
+      res.emplace_back(item);
+    }
+    return res;
+  }
+
+  static std::string join(const std::string &directory, const std::string &name) {
+    if (directory.empty() || directory.back() == '/') {
+      return directory + name;
+    }
+    return directory + "/" + name;
+  }
+
+  static bool regular_file_size(const std::string &path, size_t *byte_count) {
+    struct stat sb;
+    if (stat(path.c_str(), &sb) == -1 || (sb.st_mode & S_IFMT) != S_IFREG) {
+      return false;
+    }
+    *byte_count = sb.st_size;
+    return true;
+  }
+
+  static std::vector<std::string> list_directories(const std::string &directory) {
+    std::vector<std::string> res;
+    DIR *dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+      return res;
+    }
+    while (auto ent = readdir(dir)) {
+      const std::string name(ent->d_name);
+      if (name == "." || name == "..") {
+        continue;
+      }
+      struct stat sb;
+      if (stat(join(directory, name).c_str(), &sb) == 0 && (sb.st_mode & S_IFMT) == S_IFDIR) {
+        res.emplace_back(name);
+      }
+    }
+    closedir(dir);
+    return res;
+  }
+
+  // resolves the files of a model using the same naming conventions as
+  // get_model_params_path and get_model_symbol_path
+  static bool make_entry(const std::string &model_name, const std::string &directory_path, catalog_entry *entry) {
+    entry->name           = model_name;
+    entry->directory_path = directory_path;
+
+    bool found_params = false;
+    const std::vector<std::string> params_names{"model.params", model_name + ".params", model_name + "-0000.params"};
+    for (const auto &file_name : params_names) {
+      const auto path = join(directory_path, file_name);
+      if (regular_file_size(path, &entry->byte_count)) {
+        entry->params_path = path;
+        found_params       = true;
+        break;
+      }
+    }
+
+    bool found_symbol = false;
+    const std::vector<std::string> symbol_names{"model.symbol", model_name + ".symbol", model_name + "-symbol.json"};
+    for (const auto &file_name : symbol_names) {
+      const auto path = join(directory_path, file_name);
+      size_t byte_count;
+      if (regular_file_size(path, &byte_count)) {
+        entry->symbol_path = path;
+        found_symbol       = true;
+        break;
+      }
+    }
+
+    return found_params && found_symbol;
+  }
+
+  // the manifest takes precedence over the scanned directories. expects the
+  // lock to be held
+  void rebuild() {
+    entries_ = scanned_;
+    for (const auto &kv : manifest_) {
+      entries_[kv.first] = kv.second;
+    }
+  }
+
+  // expects the watcher to own inotify_fd_
+  void add_watches() {
+    std::string base_directory, manifest_path;
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      base_directory = base_directory_;
+      manifest_path  = manifest_path_;
+    }
+    const auto mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_DELETE_SELF;
+    inotify_add_watch(inotify_fd_, base_directory.c_str(), mask);
+    // new files are written into the model directories, so they are watched as well
+    for (const auto &name : list_directories(base_directory)) {
+      inotify_add_watch(inotify_fd_, join(base_directory, name).c_str(), mask);
+    }
+    if (!manifest_path.empty()) {
+      inotify_add_watch(inotify_fd_, manifest_path.c_str(), IN_CLOSE_WRITE | IN_MOVE_SELF | IN_DELETE_SELF);
+    }
+  }
+
+  void refresh() {
+    std::string base_directory, manifest_path;
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      base_directory = base_directory_;
+      manifest_path  = manifest_path_;
+    }
+    scan(base_directory);
+    if (!manifest_path.empty()) {
+      try {
+        load_manifest(manifest_path);
+      } catch (const std::exception &error) {
+        // keep the previous manifest entries while the manifest is being rewritten
+      }
+    }
+  }
+
+  void watch_loop() {
+    add_watches();
+    std::vector<char> buffer(64 * (sizeof(struct inotify_event) + NAME_MAX + 1));
+    while (watching_) {
+      struct pollfd pfd = {inotify_fd_, POLLIN, 0};
+      if (poll(&pfd, 1, /*timeout_ms=*/200) <= 0) {
+        continue;
+      }
+      bool changed = false;
+      while (read(inotify_fd_, buffer.data(), buffer.size()) > 0) {
+        changed = true;
+      }
+      if (!changed) {
+        continue;
+      }
+      // a model is usually copied as several files. wait for the writes to
+      // settle before rescanning
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      while (read(inotify_fd_, buffer.data(), buffer.size()) > 0) {
+      }
+      refresh();
+      add_watches();
+    }
+  }
+
+  mutable std::shared_timed_mutex mutex_;
+  std::string base_directory_{};
+  std::string manifest_path_{};
+  std::unordered_map<std::string, catalog_entry> scanned_{};
+  std::unordered_map<std::string, catalog_entry> manifest_{};
+  std::unordered_map<std::string, catalog_entry> entries_{};
+
+  std::atomic<bool> watching_{false};
+  int inotify_fd_{-1};
+  std::thread watcher_{};
+};
+
+// the catalog of the process. it is empty unless populated (by uprd), in
+// which case the model path helpers resolve names through it
+inline model_catalog &get_model_catalog() {
+  static model_catalog catalog;
+  return catalog;
+}
+
+} // namespace upr
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace upr {
+
+// Runs the completions of asynchronous forwards, in the order they are posted,
+// on a single worker thread.
+//
+// A completion waits for the outputs of its forward and invokes the callback
+// of the caller, so any number of forwards can be in flight without a thread
+// each. post returns a future that is ready once the completion ran.
+class completion_queue {
+public:
+  completion_queue() {
+    worker_ = std::thread([this]() { work(); });
+  }
+
+  completion_queue(const completion_queue &) = delete;
+  completion_queue &operator=(const completion_queue &) = delete;
+
+  // pending completions are run before the worker stops
+  ~completion_queue() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    queued_.notify_all();
+    worker_.join();
+  }
+
+  // the exceptions thrown by completion are stored in the returned future
+  std::future<void> post(std::function<void()> completion) {
+    std::packaged_task<void()> task(std::move(completion));
+    auto res = task.get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopping_) {
+        throw std::runtime_error("the completion queue is stopping");
+      }
+      queue_.emplace_back(std::move(task));
+    }
+    queued_.notify_all();
+    return res;
+  }
+
+private:
+  void work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      queued_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      auto task = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable queued_;
+  std::deque<std::packaged_task<void()>> queue_{};
+  bool stopping_{false};
+  std::thread worker_;
+};
+
+// The pending asynchronous forward of a predictor.
+//
+// Every call reading or writing the inputs, the executor or the outputs of the
+// predictor joins it first, so that a late completion can not mark the outputs
+// of an older forward as the current ones.
+class pending_forward {
+public:
+  // waits for the completion of the pending forward, if any
+  void join() {
+    if (done_.valid()) {
+      done_.get();
+    }
+  }
+
+  // joins the previous forward and posts the completion of the next one
+  void post(completion_queue *queue, std::function<void()> completion) {
+    join();
+    done_ = queue->post(std::move(completion));
+  }
+
+private:
+  std::future<void> done_{};
+};
+
+} // namespace upr
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace upr {
+
+enum class compression_type { none, fp16, int8 };
+
+static inline compression_type to_compression_type(const std::string &name) {
+  if (name == "none" || name == "") {
+    return compression_type::none;
+  }
+  if (name == "fp16") {
+    return compression_type::fp16;
+  }
+  if (name == "int8") {
+    return compression_type::int8;
+  }
+  throw std::runtime_error("invalid compression " + name + ". expecting none, fp16 or int8");
+}
+
+// round to nearest even. values beyond the half range become infinities
+static inline uint16_t float_to_half(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const uint32_t sign = (bits >> 16) & 0x8000;
+  const uint32_t abs  = bits & 0x7fffffff;
+
+  if (abs >= 0x7f800000) { // inf or nan
+    return sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0);
+  }
+  if (abs >= 0x477ff000) { // rounds to a value beyond 65504
+    return sign | 0x7c00;
+  }
+  if (abs < 0x38800000) { // subnormal half
+    if (abs < 0x33000000) {
+      return sign;
+    }
+    const uint32_t exponent = abs >> 23;
+    const uint32_t mantissa = (abs & 0x7fffff) | 0x800000;
+    const uint32_t shift    = 126 - exponent;
+    uint32_t half           = mantissa >> shift;
+    const uint32_t rest     = mantissa & ((1u << shift) - 1);
+    const uint32_t halfway  = 1u << (shift - 1);
+    if (rest > halfway || (rest == halfway && (half & 1))) {
+      half++;
+    }
+    return sign | half;
+  }
+  uint32_t half       = ((abs - 0x38000000) >> 13);
+  const uint32_t rest = abs & 0x1fff;
+  if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) {
+    half++;
+  }
+  return sign | half;
+}
+
+static inline float half_to_float(uint16_t half) {
+  const uint32_t sign     = (half & 0x8000) << 16;
+  const uint32_t exponent = (half >> 10) & 0x1f;
+  uint32_t mantissa       = half & 0x3ff;
+  uint32_t bits;
+  if (exponent == 0x1f) {
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  } else if (exponent != 0) {
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  } else if (mantissa == 0) {
+    bits = sign;
+  } else {
+    // subnormal half. normalize the mantissa
+    uint32_t e = 113;
+    while ((mantissa & 0x400) == 0) {
+      mantissa <<= 1;
+      e--;
+    }
+    bits = sign | (e << 23) | ((mantissa & 0x3ff) << 13);
+  }
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static inline void float_to_half(const float *src, size_t count, uint16_t *dst) {
+  size_t ii = 0;
+#if defined(__F16C__)
+  for (; ii + 8 <= count; ii += 8) {
+    const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + ii), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + ii), half);
+  }
+#endif
+  for (; ii < count; ii++) {
+    dst[ii] = float_to_half(src[ii]);
+  }
+}
+
+static inline void half_to_float(const uint16_t *src, size_t count, float *dst) {
+  size_t ii = 0;
+#if defined(__F16C__)
+  for (; ii + 8 <= count; ii += 8) {
+    const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + ii));
+    _mm256_storeu_ps(dst + ii, _mm256_cvtph_ps(half));
+  }
+#endif
+  for (; ii < count; ii++) {
+    dst[ii] = half_to_float(src[ii]);
+  }
+}
+
+// dst[ii] = scale * src[ii]. written so that the compiler vectorizes it
+static inline void int8_to_float(const int8_t *__restrict__ src, size_t count, float scale, float *__restrict__ dst) {
+  for (size_t ii = 0; ii < count; ii++) {
+    dst[ii] = scale * static_cast<float>(src[ii]);
+  }
+}
+
+// A compressed copy of the float32 weights of a model.
+//
+// With fp16 every layer is stored as half floats. With int8 the layers with
+// at least two dimensions are quantized symmetrically per output channel (the
+// first dimension), with one float scale per channel. the other layers (biases
+// and batch norm statistics) are small and sensitive to quantization, and are
+// kept as float32.
+//
+// The layers are addressed as if they were packed back to back as float32, so
+// any byte range of the uncompressed model can be decompressed independently.
+// this allows the decompression to be split into chunks and overlapped with
+// the transfer to the device.
+class compressed_model {
+public:
+  explicit compressed_model(compression_type type) : type_(type) {
+  }
+
+  // the number of bytes that add would use for a layer
+  static size_t compressed_byte_count(compression_type type, size_t num_elements, size_t num_channels) {
+    switch (type) {
+    case compression_type::fp16:
+      return num_elements * sizeof(uint16_t);
+    case compression_type::int8:
+      return quantized_per_channel(num_elements, num_channels) ? num_elements + num_channels * sizeof(float)
+                                                               : num_elements * sizeof(float);
+    default:
+      return num_elements * sizeof(float);
+    }
+  }
+
+  // reserves the storage of layers of byte_count compressed bytes
+  void reserve(size_t byte_count) {
+    storage_.reserve(byte_count);
+  }
+
+  // appends a layer of num_elements floats split into num_channels channels
+  // of equal size. num_channels is the first dimension of the layer, or 0 for
+  // layers that must not be quantized (those with fewer than two dimensions)
+  void add(const float *data, size_t num_elements, size_t num_channels) {
+    layer l;
+    l.num_elements = num_elements;
+    l.offset       = storage_.size();
+    l.float_offset = decompressed_byte_count_;
+    if (type_ == compression_type::fp16) {
+      l.format = kind::fp16;
+      storage_.resize(storage_.size() + num_elements * sizeof(uint16_t));
+      float_to_half(data, num_elements, reinterpret_cast<uint16_t *>(&storage_[l.offset]));
+    } else if (type_ == compression_type::int8 && quantized_per_channel(num_elements, num_channels)) {
+      l.format       = kind::int8;
+      l.channel_size = num_elements / num_channels;
+      l.scales.resize(num_channels);
+      storage_.resize(storage_.size() + num_elements);
+      auto dst = reinterpret_cast<int8_t *>(&storage_[l.offset]);
+      for (size_t cc = 0; cc < num_channels; cc++) {
+        const float *channel = data + cc * l.channel_size;
+        float max_abs        = 0;
+        for (size_t ii = 0; ii < l.channel_size; ii++) {
+          max_abs = std::max(max_abs, std::fabs(channel[ii]));
+        }
+        const float scale = max_abs == 0 ? 1 : max_abs / 127;
+        l.scales[cc]      = scale;
+        for (size_t ii = 0; ii < l.channel_size; ii++) {
+          const auto q                  = std::nearbyint(channel[ii] / scale);
+          dst[cc * l.channel_size + ii] = static_cast<int8_t>(std::max(-127.0f, std::min(127.0f, q)));
+        }
+      }
+    } else {
+      l.format = kind::fp32;
+      storage_.resize(storage_.size() + num_elements * sizeof(float));
+      memcpy(&storage_[l.offset], data, num_elements * sizeof(float));
+    }
+    decompressed_byte_count_ += num_elements * sizeof(float);
+    layers_.emplace_back(std::move(l));
+  }
+
+  compression_type type() const {
+    return type_;
+  }
+
+  // the bytes used by the compressed copy
+  size_t byte_count() const {
+    size_t res = storage_.size();
+    for (const auto &l : layers_) {
+      res += l.scales.size() * sizeof(float);
+    }
+    return res;
+  }
+
+  // the bytes of the model as float32
+  size_t decompressed_byte_count() const {
+    return decompressed_byte_count_;
+  }
+
+  // decompresses the float32 bytes [begin, begin + byte_count) of the model
+  // into dst. begin and byte_count must be multiples of sizeof(float)
+  void decompress(size_t begin, size_t byte_count, char *dst) const {
+    if (begin % sizeof(float) != 0 || byte_count % sizeof(float) != 0 ||
+        begin + byte_count > decompressed_byte_count_) {
+      throw std::runtime_error("invalid range to decompress");
+    }
+    const size_t end = begin + byte_count;
+    // the last layer that starts at or before begin
+    auto it = std::upper_bound(layers_.begin(), layers_.end(), begin,
+                               [](size_t offset, const layer &l) { return offset < l.float_offset; });
+    it--;
+    for (auto pos = begin; pos < end; it++) {
+      const auto &l      = *it;
+      const size_t first = (pos - l.float_offset) / sizeof(float);
+      const size_t last  = std::min(l.num_elements, (end - l.float_offset) / sizeof(float));
+      auto out           = reinterpret_cast<float *>(dst + (pos - begin));
+      decompress_layer(l, first, last, out);
+      pos = l.float_offset + last * sizeof(float);
+    }
+  }
+
+private:
+  enum class kind { fp32, fp16, int8 };
+
+  // only layers with more than one element per channel are quantized
+  static bool quantized_per_channel(size_t num_elements, size_t num_channels) {
+    return num_channels >= 1 && num_elements > num_channels && num_elements % num_channels == 0;
+  }
+
+  struct layer {
+    kind format{kind::fp32};
+    size_t num_elements{0};
+    // offset of the layer in storage_
+    size_t offset{0};
+    // offset of the layer in the float32 model
+    size_t float_offset{0};
+    size_t channel_size{0};
+    std::vector<float> scales{};
+  };
+
+  // decompresses the elements [first, last) of the layer
+  void decompress_layer(const layer &l, size_t first, size_t last, float *dst) const {
+    const char *src = &storage_[l.offset];
+    switch (l.format) {
+    case kind::fp32:
+      memcpy(dst, reinterpret_cast<const float *>(src) + first, (last - first) * sizeof(float));
+      return;
+    case kind::fp16:
+      half_to_float(reinterpret_cast<const uint16_t *>(src) + first, last - first, dst);
+      return;
+    case kind::int8: {
+      const auto q = reinterpret_cast<const int8_t *>(src);
+      for (auto ii = first; ii < last;) {
+        const size_t channel = ii / l.channel_size;
+        const size_t stop    = std::min(last, (channel + 1) * l.channel_size);
+        int8_to_float(q + ii, stop - ii, l.scales[channel], dst + (ii - first));
+        ii = stop;
+      }
+      return;
+    }
+    }
+  }
+
+  const compression_type type_;
+  std::vector<char> storage_{};
+  std::vector<layer> layers_{};
+  size_t decompressed_byte_count_{0};
+};
+
+} // namespace upr
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace upr {
+
+// a 128 bit digest of the content of a layer
+struct layer_digest {
+  uint64_t hi{0};
+  uint64_t lo{0};
+  size_t byte_count{0};
+
+  std::string str() const {
+    static const char digits[] = "0123456789abcdef";
+    std::string res(32, '0');
+    for (int ii = 0; ii < 16; ii++) {
+      res[15 - ii] = digits[(hi >> (4 * ii)) & 0xf];
+      res[31 - ii] = digits[(lo >> (4 * ii)) & 0xf];
+    }
+    return res + "-" + std::to_string(byte_count);
+  }
+};
+
+// hashes the content of a layer (or of any buffer, such as a symbol json) 8
+// bytes at a time in two independent lanes. this is not a cryptographic hash.
+// the models are trusted, and the digest is only used to detect identical
+// content
+static inline layer_digest digest_layer(const void *data, size_t byte_count) {
+  const auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+  const auto fmix = [](uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    return h;
+  };
+
+  uint64_t a = 0x9e3779b97f4a7c15 ^ byte_count;
+  uint64_t b = 0xc2b2ae3d27d4eb4f ^ byte_count;
+
+  const auto *bytes     = static_cast<const char *>(data);
+  const size_t num_words = byte_count / sizeof(uint64_t);
+  for (size_t ii = 0; ii < num_words; ii++) {
+    uint64_t word;
+    memcpy(&word, bytes + ii * sizeof(uint64_t), sizeof(word));
+    a = rotl(a ^ (word * 0x87c37b91114253d5), 31) * 0x4cf5ad432745937f;
+    b = rotl(b ^ (word * 0x52dce729da3ed7b3), 29) * 0x165667b19e3779f9;
+  }
+  uint64_t tail = 0;
+  memcpy(&tail, bytes + num_words * sizeof(uint64_t), byte_count % sizeof(uint64_t));
+  a ^= tail * 0x87c37b91114253d5;
+  b ^= tail * 0x52dce729da3ed7b3;
+
+  layer_digest res;
+  res.hi         = fmix(a + b);
+  res.lo         = fmix(b + res.hi);
+  res.byte_count = byte_count;
+  return res;
+}
+
+} // namespace upr
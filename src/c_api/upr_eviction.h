@@ -0,0 +1,299 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace upr {
+
+struct eviction_entry {
+  // bytes used by the resident model
+  size_t byte_count{0};
+  // number of open handles. pinned (ref_count > 0) models are never evicted
+  int64_t ref_count{0};
+  // number of times the model has been opened while resident
+  uint64_t frequency{0};
+  // residency order (for fifo)
+  uint64_t order{0};
+  // cost of bringing the model back once evicted (the measured load time in
+  // microseconds)
+  double cost{0};
+};
+
+// Bookkeeping used to select eviction victims.
+//
+// Every resident model is tracked by the index, but only unpinned models are
+// eviction candidates. The candidates are kept in a policy specific structure
+// that is updated on insert/erase/acquire/release, so selecting a victim never
+// scans the resident models.
+class eviction_index {
+public:
+  virtual ~eviction_index() = default;
+
+  // a model became resident (unpinned)
+  void insert(const std::string &key, size_t byte_count, double cost = 0) {
+    erase(key);
+    auto &entry      = entries_[key];
+    entry.byte_count = byte_count;
+    entry.order      = next_order_++;
+    entry.cost       = cost;
+    add_candidate(key, entry);
+  }
+
+  // a model is no longer resident
+  void erase(const std::string &key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return;
+    }
+    if (it->second.ref_count == 0) {
+      on_erase_candidate(key, it->second);
+      remove_candidate(key, it->second);
+    }
+    entries_.erase(it);
+  }
+
+  // a handle to the model was opened
+  void acquire(const std::string &key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return;
+    }
+    auto &entry = it->second;
+    if (entry.ref_count == 0) {
+      remove_candidate(key, entry);
+    }
+    entry.ref_count++;
+    entry.frequency++;
+  }
+
+  // a handle to the model was closed
+  void release(const std::string &key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second.ref_count == 0) {
+      return;
+    }
+    auto &entry = it->second;
+    entry.ref_count--;
+    if (entry.ref_count == 0) {
+      add_candidate(key, entry);
+    }
+  }
+
+  const eviction_entry *find(const std::string &key) const {
+    const auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    return &it->second;
+  }
+
+  size_t size() const {
+    return entries_.size();
+  }
+
+  // the next model to evict. returns false if every resident model is pinned
+  virtual bool victim(std::string *key) const = 0;
+
+protected:
+  virtual void add_candidate(const std::string &key, const eviction_entry &entry)    = 0;
+  virtual void remove_candidate(const std::string &key, const eviction_entry &entry) = 0;
+  // a candidate stops being resident (it was evicted)
+  virtual void on_erase_candidate(const std::string &, const eviction_entry &) {
+  }
+
+  std::unordered_map<std::string, eviction_entry> entries_{};
+  uint64_t next_order_{0};
+};
+
+// never evicts
+class no_eviction_index final : public eviction_index {
+public:
+  bool victim(std::string *) const override {
+    return false;
+  }
+
+protected:
+  void add_candidate(const std::string &, const eviction_entry &) override {
+  }
+  void remove_candidate(const std::string &, const eviction_entry &) override {
+  }
+};
+
+// least recently used. a model becomes a candidate when its last handle is
+// closed, so the candidate list is ordered by the time of last use
+class lru_eviction_index final : public eviction_index {
+public:
+  bool victim(std::string *key) const override {
+    if (candidates_.empty()) {
+      return false;
+    }
+    *key = candidates_.front();
+    return true;
+  }
+
+protected:
+  void add_candidate(const std::string &key, const eviction_entry &) override {
+    positions_[key] = candidates_.insert(candidates_.end(), key);
+  }
+  void remove_candidate(const std::string &key, const eviction_entry &) override {
+    const auto it = positions_.find(key);
+    if (it == positions_.end()) {
+      return;
+    }
+    candidates_.erase(it->second);
+    positions_.erase(it);
+  }
+
+private:
+  std::list<std::string> candidates_{};
+  std::unordered_map<std::string, std::list<std::string>::iterator> positions_{};
+};
+
+// first in first out, by the order in which the models became resident
+class fifo_eviction_index final : public eviction_index {
+public:
+  bool victim(std::string *key) const override {
+    if (candidates_.empty()) {
+      return false;
+    }
+    *key = candidates_.begin()->second;
+    return true;
+  }
+
+protected:
+  void add_candidate(const std::string &key, const eviction_entry &entry) override {
+    candidates_.emplace(entry.order, key);
+  }
+  void remove_candidate(const std::string &, const eviction_entry &entry) override {
+    candidates_.erase(entry.order);
+  }
+
+private:
+  std::map<uint64_t, std::string> candidates_{};
+};
+
+// least commonly used. candidates are bucketed by the number of times they
+// were opened, and within a bucket ordered by the time of last use
+class lcu_eviction_index final : public eviction_index {
+public:
+  bool victim(std::string *key) const override {
+    if (buckets_.empty()) {
+      return false;
+    }
+    *key = buckets_.begin()->second.front();
+    return true;
+  }
+
+protected:
+  void add_candidate(const std::string &key, const eviction_entry &entry) override {
+    auto &bucket    = buckets_[entry.frequency];
+    positions_[key] = bucket.insert(bucket.end(), key);
+  }
+  void remove_candidate(const std::string &key, const eviction_entry &entry) override {
+    const auto it = positions_.find(key);
+    if (it == positions_.end()) {
+      return;
+    }
+    auto bucket = buckets_.find(entry.frequency);
+    bucket->second.erase(it->second);
+    if (bucket->second.empty()) {
+      buckets_.erase(bucket);
+    }
+    positions_.erase(it);
+  }
+
+private:
+  std::map<uint64_t, std::list<std::string>> buckets_{};
+  std::unordered_map<std::string, std::list<std::string>::iterator> positions_{};
+};
+
+// greedy dual size frequency. candidates are ordered by
+//   priority = clock + frequency * cost / byte_count
+// so models that are cheap to reload, rarely used or large are evicted first.
+// the clock is raised to the priority of every evicted model, which ages the
+// models that have not been used since
+class gdsf_eviction_index final : public eviction_index {
+public:
+  bool victim(std::string *key) const override {
+    if (candidates_.empty()) {
+      return false;
+    }
+    *key = candidates_.begin()->second;
+    return true;
+  }
+
+  double priority(const std::string &key) const {
+    const auto it = positions_.find(key);
+    if (it == positions_.end()) {
+      return 0;
+    }
+    return it->second->first;
+  }
+
+protected:
+  void add_candidate(const std::string &key, const eviction_entry &entry) override {
+    const double frequency  = entry.frequency == 0 ? 1 : entry.frequency;
+    const double byte_count = entry.byte_count == 0 ? 1 : entry.byte_count;
+    const auto priority     = clock_ + frequency * entry.cost / byte_count;
+    positions_[key]         = candidates_.emplace(priority, key);
+  }
+  void remove_candidate(const std::string &key, const eviction_entry &) override {
+    const auto it = positions_.find(key);
+    if (it == positions_.end()) {
+      return;
+    }
+    candidates_.erase(it->second);
+    positions_.erase(it);
+  }
+  void on_erase_candidate(const std::string &key, const eviction_entry &) override {
+    const auto evicted_priority = priority(key);
+    if (evicted_priority > clock_) {
+      clock_ = evicted_priority;
+    }
+  }
+
+private:
+  double clock_{0};
+  std::multimap<double, std::string> candidates_{};
+  std::unordered_map<std::string, std::multimap<double, std::string>::iterator> positions_{};
+};
+
+// creates the index for one of the UPRD_EVICTION_POLICY values.
+// flush/all evict every candidate and eager evicts on close, and both pick
+// their victims in lru order
+static inline std::unique_ptr<eviction_index> make_eviction_index(const std::string &policy) {
+  if (policy == "never") {
+    return std::unique_ptr<eviction_index>(new no_eviction_index());
+  }
+  if (policy == "lru" || policy == "flush" || policy == "all" || policy == "eager") {
+    return std::unique_ptr<eviction_index>(new lru_eviction_index());
+  }
+  if (policy == "fifo") {
+    return std::unique_ptr<eviction_index>(new fifo_eviction_index());
+  }
+  if (policy == "lcu") { // least commonly used
+    return std::unique_ptr<eviction_index>(new lcu_eviction_index());
+  }
+  if (policy == "gdsf") { // greedy dual size frequency
+    return std::unique_ptr<eviction_index>(new gdsf_eviction_index());
+  }
+  throw std::runtime_error("the eviction policy " + policy + " is not valid");
+}
+
+// creates the index for one of the UPRD_CPU_EVICTION_POLICY values. only the
+// policies that order models by their use apply to the cpu tier: flush/all and
+// eager describe when device memory is released, and gdsf needs the reload
+// cost, which is not measured for the cpu copies
+static inline std::unique_ptr<eviction_index> make_cpu_eviction_index(const std::string &policy) {
+  if (policy != "never" && policy != "lru" && policy != "fifo" && policy != "lcu") {
+    throw std::runtime_error("the cpu eviction policy " + policy + " is not valid. expecting never, lru, fifo or lcu");
+  }
+  return make_eviction_index(policy);
+}
+
+} // namespace upr
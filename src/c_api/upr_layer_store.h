@@ -0,0 +1,109 @@
+#pragma once
+
+#include "upr_digest.h"
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace upr {
+
+// A content addressed store of layer allocations.
+//
+// Every allocation is keyed by the digest of the weights it holds and is
+// reference counted, so models that share weights (for example variants of a
+// model that only differ in their head) share the allocations of the
+// identical layers. The store does not allocate or free memory itself.
+class layer_store {
+public:
+  using allocate_fn = std::function<void *()>;
+  using free_fn     = std::function<void(void *)>;
+
+  // returns the allocation holding the weights with the given digest, and
+  // takes a reference to it. on a miss, allocate is called (without holding
+  // the store lock) and must return an allocation holding the weights. if a
+  // concurrent acquire inserted the same weights first, the new allocation is
+  // released with free_ptr. hit is set if no allocation was added
+  void *acquire(const layer_digest &digest, const allocate_fn &allocate, const free_fn &free_ptr, bool *hit) {
+    const auto key = digest.str();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        it->second.ref_count++;
+        *hit = true;
+        return it->second.ptr;
+      }
+    }
+
+    void *ptr = allocate();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      it->second.ref_count++;
+      free_ptr(ptr);
+      *hit = true;
+      return it->second.ptr;
+    }
+    entries_.emplace(key, entry{ptr, digest.byte_count, 1});
+    keys_.emplace(ptr, key);
+    byte_count_ += digest.byte_count;
+    *hit = false;
+    return ptr;
+  }
+
+  // drops a reference to an allocation returned by acquire. once the last
+  // reference is dropped, the allocation is removed from the store and freed
+  // with free_ptr. returns the number of bytes freed
+  size_t release(void *ptr, const free_fn &free_ptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto key = keys_.find(ptr);
+    if (key == keys_.end()) {
+      return 0;
+    }
+    auto it = entries_.find(key->second);
+    if (--it->second.ref_count > 0) {
+      return 0;
+    }
+    const auto byte_count = it->second.byte_count;
+    free_ptr(ptr);
+    byte_count_ -= byte_count;
+    entries_.erase(it);
+    keys_.erase(key);
+    return byte_count;
+  }
+
+  bool contains(void *ptr) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return keys_.count(ptr) != 0;
+  }
+
+  // the number of distinct allocations
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  // the bytes held by the distinct allocations
+  size_t byte_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return byte_count_;
+  }
+
+private:
+  struct entry {
+    void *ptr;
+    size_t byte_count;
+    int64_t ref_count;
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, entry> entries_{};
+  std::unordered_map<void *, std::string> keys_{};
+  size_t byte_count_{0};
+};
+
+} // namespace upr
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace upr {
+
+// a handle opened by a client under a lease
+struct leased_handle {
+  std::string client_id{};
+  std::string model_id{};
+  std::string handle_id{};
+};
+
+// The leases of the handles opened by the clients. A client (a process) holds
+// one lease covering every handle it has open, and renews it with a heartbeat.
+// A lease that is not renewed for ttl expires, and its handles are returned by
+// expire so that they can be closed on behalf of the client, e.g. after the
+// client crashed. The lease of a client is dropped once it closes its last
+// handle.
+class lease_table {
+public:
+  using clock = std::chrono::steady_clock;
+
+  explicit lease_table(std::chrono::milliseconds ttl) : ttl_(ttl) {
+  }
+
+  std::chrono::milliseconds ttl() const {
+    return ttl_;
+  }
+
+  // adds the handle to the lease of its client and renews the lease
+  void add(const leased_handle &handle, clock::time_point now = clock::now()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &l                     = leases_[handle.client_id];
+    l.expires_at                = now + ttl_;
+    l.handles[handle.handle_id] = handle;
+    owners_[handle.handle_id]   = handle.client_id;
+  }
+
+  // removes a closed handle. returns false if the handle was not leased
+  bool remove(const std::string &handle_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto owner = owners_.find(handle_id);
+    if (owner == owners_.end()) {
+      return false;
+    }
+    auto l = leases_.find(owner->second);
+    l->second.handles.erase(handle_id);
+    if (l->second.handles.empty()) {
+      leases_.erase(l);
+    }
+    owners_.erase(owner);
+    return true;
+  }
+
+  // returns false if the client holds no lease, either because it has no
+  // handle open or because its lease expired
+  bool renew(const std::string &client_id, clock::time_point now = clock::now()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto l = leases_.find(client_id);
+    if (l == leases_.end()) {
+      return false;
+    }
+    l->second.expires_at = now + ttl_;
+    return true;
+  }
+
+  // removes the expired leases and returns their handles
+  std::vector<leased_handle> expire(clock::time_point now = clock::now()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<leased_handle> res{};
+    for (auto l = leases_.begin(); l != leases_.end();) {
+      if (l->second.expires_at > now) {
+        ++l;
+        continue;
+      }
+      for (const auto &handle : l->second.handles) {
+        owners_.erase(handle.first);
+        res.emplace_back(handle.second);
+      }
+      l = leases_.erase(l);
+    }
+    return res;
+  }
+
+  // the number of clients holding a lease
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return leases_.size();
+  }
+
+  // the number of leased handles
+  size_t num_handles() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return owners_.size();
+  }
+
+private:
+  struct lease {
+    clock::time_point expires_at{};
+    // keyed by handle id
+    std::unordered_map<std::string, leased_handle> handles{};
+  };
+
+  const std::chrono::milliseconds ttl_;
+  mutable std::mutex mutex_;
+  // keyed by client id
+  std::unordered_map<std::string, lease> leases_{};
+  // the client id of every leased handle
+  std::unordered_map<std::string, std::string> owners_{};
+};
+
+// checks the leases of a table every quarter of their ttl, and passes the
+// handles of the expired ones to reclaim
+class lease_reaper {
+public:
+  using reclaim_fn = std::function<void(const std::vector<leased_handle> &)>;
+
+  lease_reaper(lease_table *leases, reclaim_fn reclaim) : leases_(leases), reclaim_(std::move(reclaim)) {
+    worker_ = std::thread([this]() { work(); });
+  }
+
+  lease_reaper(const lease_reaper &) = delete;
+  lease_reaper &operator=(const lease_reaper &) = delete;
+
+  ~lease_reaper() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    stopped_.notify_all();
+    worker_.join();
+  }
+
+private:
+  void work() {
+    const auto interval = std::max(leases_->ttl() / 4, std::chrono::milliseconds(1));
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_.wait_for(lock, interval, [this]() { return stopping_; })) {
+      lock.unlock();
+      const auto expired = leases_->expire();
+      if (!expired.empty()) {
+        reclaim_(expired);
+      }
+      lock.lock();
+    }
+  }
+
+  lease_table *leases_;
+  const reclaim_fn reclaim_;
+
+  std::mutex mutex_;
+  std::condition_variable stopped_;
+  bool stopping_{false};
+  std::thread worker_;
+};
+
+} // namespace upr
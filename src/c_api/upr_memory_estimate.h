@@ -0,0 +1,90 @@
+#pragma once
+
+#include "upr_prepared_graph.h"
+
+#include <algorithm>
+#include <mxnet/ndarray.h>
+#include <nnvm/graph.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace upr {
+
+// the device memory needed to serve a model, as predicted from its graph
+struct graph_memory_estimate {
+  // bytes of the parameters (every graph input other than the data input)
+  size_t param_bytes{0};
+  // peak bytes of the intermediate results during a forward pass
+  size_t activation_bytes{0};
+};
+
+// estimates the memory used by a forward pass of the model described by
+// symbol_json when input_name has the shape input_shape.
+//
+// the shapes and types of every entry are inferred from the graph. the nodes
+// are then visited in topological order, and an entry is considered live from
+// the time it is produced until its last consumer runs. the activation bytes
+// is the peak of the live bytes. in place operations and operator workspaces
+// are not modelled, so the estimate is an upper bound of the memory plan of the
+// executor, up to the workspace
+static inline graph_memory_estimate estimate_graph_memory(const std::string &symbol_json, const std::string &input_name,
+                                                          const mxnet::TShape &input_shape) {
+  const auto graph = infer_graph(symbol_json, input_name, input_shape);
+
+  const auto &idx    = graph.indexed_graph();
+  const auto &shapes = graph.GetAttr<nnvm::ShapeVector>("shape");
+  const auto &dtypes = graph.GetAttr<nnvm::DTypeVector>("dtype");
+
+  const auto entry_bytes = [&](uint32_t eid) -> size_t {
+    // the types that cannot be inferred are assumed to be float32
+    const size_t type_size = dtypes[eid] == -1 ? sizeof(float) : mshadow::mshadow_sizeof(dtypes[eid]);
+    return shapes[eid].Size() * type_size;
+  };
+
+  std::vector<bool> is_param(idx.num_nodes(), false);
+  graph_memory_estimate estimate;
+  for (const auto nid : idx.input_nodes()) {
+    if (idx[nid].source->attrs.name == input_name) {
+      continue;
+    }
+    is_param[nid] = true;
+    estimate.param_bytes += entry_bytes(idx.entry_id(nid, 0));
+  }
+
+  // the number of consumers of every entry. the outputs of the graph are
+  // never released
+  std::vector<uint32_t> ref_count(idx.num_node_entries(), 0);
+  for (uint32_t nid = 0; nid < idx.num_nodes(); nid++) {
+    for (const auto &e : idx[nid].inputs) {
+      ref_count[idx.entry_id(e)]++;
+    }
+  }
+  for (const auto &e : idx.outputs()) {
+    ref_count[idx.entry_id(e)]++;
+  }
+
+  size_t live_bytes = 0;
+  size_t peak_bytes = 0;
+  for (uint32_t nid = 0; nid < idx.num_nodes(); nid++) {
+    const auto &node = idx[nid];
+    if (is_param[nid]) {
+      continue;
+    }
+    for (uint32_t index = 0; index < node.source->num_outputs(); index++) {
+      live_bytes += entry_bytes(idx.entry_id(nid, index));
+    }
+    peak_bytes = std::max(peak_bytes, live_bytes);
+    for (const auto &e : node.inputs) {
+      const auto eid = idx.entry_id(e);
+      if (!is_param[e.node_id] && --ref_count[eid] == 0) {
+        live_bytes -= entry_bytes(eid);
+      }
+    }
+  }
+  estimate.activation_bytes = peak_bytes;
+
+  return estimate;
+}
+
+} // namespace upr
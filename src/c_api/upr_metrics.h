@@ -0,0 +1,364 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace upr {
+
+class counter {
+public:
+  void add(uint64_t n = 1) {
+    value_.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  uint64_t value() const {
+    return value_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<uint64_t> value_{0};
+};
+
+// A histogram of latencies (in microseconds) in the spirit of HdrHistogram.
+// values below 8 have their own bucket, and every power of two range above is
+// split into 8 linear buckets, so a percentile is within 12.5% of the exact
+// value. recording is lock free and costs a few relaxed atomic adds
+class latency_histogram {
+public:
+  static constexpr int sub_bucket_bits = 3;
+  static constexpr size_t sub_bucket_count = size_t{1} << sub_bucket_bits;
+  static constexpr size_t num_buckets      = sub_bucket_count + (64 - sub_bucket_bits) * sub_bucket_count;
+
+  struct bucket {
+    // the largest value of the bucket
+    uint64_t upper_bound{0};
+    uint64_t count{0};
+  };
+
+  static size_t bucket_index(uint64_t value) {
+    if (value < sub_bucket_count) {
+      return value;
+    }
+    int msb = 63;
+    while ((value >> msb) == 0) {
+      msb--;
+    }
+    const auto shift = msb - sub_bucket_bits;
+    const auto sub   = (value >> shift) - sub_bucket_count;
+    return sub_bucket_count + (msb - sub_bucket_bits) * sub_bucket_count + sub;
+  }
+
+  static uint64_t bucket_upper_bound(size_t index) {
+    if (index < sub_bucket_count) {
+      return index;
+    }
+    const auto range = (index - sub_bucket_count) / sub_bucket_count;
+    const auto sub   = (index - sub_bucket_count) % sub_bucket_count;
+    // wraps around to the largest value for the last bucket
+    return ((sub_bucket_count + sub + 1) << range) - 1;
+  }
+
+  void record(uint64_t value) {
+    buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    auto max = max_.load(std::memory_order_relaxed);
+    while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  void record(std::chrono::microseconds duration) {
+    record(static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0)));
+  }
+
+  uint64_t count() const {
+    return count_.load(std::memory_order_relaxed);
+  }
+
+  uint64_t sum() const {
+    return sum_.load(std::memory_order_relaxed);
+  }
+
+  uint64_t max() const {
+    return max_.load(std::memory_order_relaxed);
+  }
+
+  // the upper bound of the bucket holding the q quantile (0 <= q <= 1),
+  // capped by the largest value recorded. 0 if nothing was recorded
+  uint64_t percentile(double q) const {
+    const auto snapshot = buckets();
+    uint64_t total      = 0;
+    for (const auto &b : snapshot) {
+      total += b.count;
+    }
+    if (total == 0) {
+      return 0;
+    }
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(q * total + 0.5));
+    uint64_t seen   = 0;
+    for (const auto &b : snapshot) {
+      seen += b.count;
+      if (seen >= rank) {
+        return std::min(b.upper_bound, max());
+      }
+    }
+    return max();
+  }
+
+  // the non empty buckets, in increasing order. the buckets are read one by
+  // one, so a snapshot taken while recording may not add up to count()
+  std::vector<bucket> buckets() const {
+    std::vector<bucket> res{};
+    for (size_t ii = 0; ii < num_buckets; ii++) {
+      const auto count = buckets_[ii].load(std::memory_order_relaxed);
+      if (count != 0) {
+        res.emplace_back(bucket{bucket_upper_bound(ii), count});
+      }
+    }
+    return res;
+  }
+
+private:
+  std::atomic<uint64_t> buckets_[num_buckets]{};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> max_{0};
+};
+
+// records the time elapsed between its construction and its destruction
+class latency_timer {
+public:
+  explicit latency_timer(latency_histogram *histogram)
+      : histogram_(histogram), start_(std::chrono::steady_clock::now()) {
+  }
+
+  ~latency_timer() {
+    histogram_->record(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_));
+  }
+
+private:
+  latency_histogram *histogram_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+// renders metrics in the prometheus text exposition format. the HELP and TYPE
+// lines are written before the first sample of every metric
+class prometheus_writer {
+public:
+  using labels = std::map<std::string, std::string>;
+
+  void counter(const std::string &name, const std::string &help, uint64_t value, const labels &l = {}) {
+    declare(name, help, "counter");
+    sample(name, l, std::to_string(value));
+  }
+
+  void gauge(const std::string &name, const std::string &help, double value, const labels &l = {}) {
+    declare(name, help, "gauge");
+    sample(name, l, format_double(value));
+  }
+
+  // the buckets are exported at the end of every power of two range, from 1us
+  // up to 2^max_range_bits us (about 12 days)
+  void histogram(const std::string &name, const std::string &help, const latency_histogram &histogram) {
+    static constexpr int max_range_bits = 40;
+    declare(name, help, "histogram");
+    const auto buckets = histogram.buckets();
+    uint64_t cumulative = 0;
+    size_t next         = 0;
+    for (int bits = 1; bits <= max_range_bits; bits++) {
+      const auto le = (uint64_t{1} << bits) - 1;
+      while (next < buckets.size() && buckets[next].upper_bound <= le) {
+        cumulative += buckets[next++].count;
+      }
+      sample(name + "_bucket", {{"le", std::to_string(le)}}, std::to_string(cumulative));
+    }
+    while (next < buckets.size()) {
+      cumulative += buckets[next++].count;
+    }
+    sample(name + "_bucket", {{"le", "+Inf"}}, std::to_string(cumulative));
+    sample(name + "_sum", {}, std::to_string(histogram.sum()));
+    sample(name + "_count", {}, std::to_string(cumulative));
+  }
+
+  const std::string &str() const {
+    return out_;
+  }
+
+private:
+  static std::string format_double(double value) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.17g", value);
+    return buf;
+  }
+
+  static std::string escape(const std::string &value) {
+    std::string res{};
+    for (const auto c : value) {
+      if (c == '\\' || c == '"') {
+        res += '\\';
+        res += c;
+      } else if (c == '\n') {
+        res += "\\n";
+      } else {
+        res += c;
+      }
+    }
+    return res;
+  }
+
+  void declare(const std::string &name, const std::string &help, const char *type) {
+    if (!declared_.insert(name).second) {
+      return;
+    }
+    out_ += "# HELP " + name + " " + help + "\n";
+    out_ += "# TYPE " + name + " " + type + "\n";
+  }
+
+  void sample(const std::string &name, const labels &l, const std::string &value) {
+    out_ += name;
+    if (!l.empty()) {
+      out_ += "{";
+      bool first = true;
+      for (const auto &kv : l) {
+        out_ += (first ? "" : ",") + kv.first + "=\"" + escape(kv.second) + "\"";
+        first = false;
+      }
+      out_ += "}";
+    }
+    out_ += " " + value + "\n";
+  }
+
+  std::string out_{};
+  std::set<std::string> declared_{};
+};
+
+// A named set of counters and histograms. metrics are added when the owner is
+// constructed and live as long as the registry, so the references returned
+// can be recorded to without any lookup
+class metrics_registry {
+public:
+  upr::counter &add_counter(const std::string &name, const std::string &help) {
+    counters_.emplace_back(new named<upr::counter>{name, help, {}});
+    return counters_.back()->metric;
+  }
+
+  latency_histogram &add_histogram(const std::string &name, const std::string &help) {
+    histograms_.emplace_back(new named<latency_histogram>{name, help, {}});
+    return histograms_.back()->metric;
+  }
+
+  void for_each_counter(const std::function<void(const std::string &, const upr::counter &)> &fn) const {
+    for (const auto &c : counters_) {
+      fn(c->name, c->metric);
+    }
+  }
+
+  void for_each_histogram(const std::function<void(const std::string &, const latency_histogram &)> &fn) const {
+    for (const auto &h : histograms_) {
+      fn(h->name, h->metric);
+    }
+  }
+
+  void write(prometheus_writer *writer) const {
+    for (const auto &c : counters_) {
+      writer->counter(c->name, c->help, c->metric.value());
+    }
+    for (const auto &h : histograms_) {
+      writer->histogram(h->name, h->help, h->metric);
+    }
+  }
+
+private:
+  template <typename T>
+  struct named {
+    std::string name;
+    std::string help;
+    T metric;
+  };
+
+  std::vector<std::unique_ptr<named<upr::counter>>> counters_{};
+  std::vector<std::unique_ptr<named<latency_histogram>>> histograms_{};
+};
+
+// periodically writes the text returned by render to path, e.g. for the
+// textfile collector of the prometheus node exporter. the text is written to
+// a temporary file that is renamed over path, so readers never see a partial
+// file. the file is written once more when the exporter stops
+class metrics_file_exporter {
+public:
+  metrics_file_exporter(std::string path, std::chrono::milliseconds interval, std::function<std::string()> render)
+      : path_(std::move(path)), interval_(interval), render_(std::move(render)) {
+    worker_ = std::thread([this]() { work(); });
+  }
+
+  metrics_file_exporter(const metrics_file_exporter &) = delete;
+  metrics_file_exporter &operator=(const metrics_file_exporter &) = delete;
+
+  ~metrics_file_exporter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    stopped_.notify_all();
+    worker_.join();
+  }
+
+  // writes the metrics now. throws a runtime_error if the file cannot be written
+  void write() const {
+    const auto tmp_path = path_ + ".tmp";
+    {
+      std::ofstream out(tmp_path, std::ios::trunc);
+      out << render_();
+      if (!out) {
+        throw std::runtime_error("unable to write the metrics to " + tmp_path);
+      }
+    }
+    if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+      throw std::runtime_error("unable to rename " + tmp_path + " to " + path_);
+    }
+  }
+
+private:
+  void work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      const auto stopping = stopped_.wait_for(lock, interval_, [this]() { return stopping_; });
+      lock.unlock();
+      try {
+        write();
+      } catch (const std::exception &) {
+        // the next interval retries
+      }
+      lock.lock();
+      if (stopping) {
+        return;
+      }
+    }
+  }
+
+  const std::string path_;
+  const std::chrono::milliseconds interval_;
+  const std::function<std::string()> render_;
+
+  std::mutex mutex_;
+  std::condition_variable stopped_;
+  bool stopping_{false};
+  std::thread worker_;
+};
+
+} // namespace upr
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace upr {
+
+// A fixed set of objects handed out to one user at a time. acquire blocks
+// until an object is available. The pool does not own the objects.
+template <typename T>
+class object_pool {
+public:
+  void add(T *obj) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    all_.emplace_back(obj);
+    free_.emplace_back(obj);
+    available_.notify_one();
+  }
+
+  T *acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (all_.empty()) {
+      throw std::runtime_error("the pool is empty");
+    }
+    available_.wait(lock, [this]() { return !free_.empty(); });
+    auto obj = free_.back();
+    free_.pop_back();
+    return obj;
+  }
+
+  // returns nullptr if no object is available
+  T *try_acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.empty()) {
+      return nullptr;
+    }
+    auto obj = free_.back();
+    free_.pop_back();
+    return obj;
+  }
+
+  void release(T *obj) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (std::find(all_.begin(), all_.end(), obj) == all_.end()) {
+      throw std::runtime_error("the object does not belong to the pool");
+    }
+    if (std::find(free_.begin(), free_.end(), obj) != free_.end()) {
+      throw std::runtime_error("the object was released twice");
+    }
+    free_.emplace_back(obj);
+    available_.notify_one();
+  }
+
+  // every object of the pool, acquired or not
+  std::vector<T *> objects() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return all_;
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return all_.size();
+  }
+
+  size_t available() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return free_.size();
+  }
+
+private:
+  mutable std::mutex mutex_;
+  std::condition_variable available_;
+  std::vector<T *> all_{};
+  std::vector<T *> free_{};
+};
+
+} // namespace upr
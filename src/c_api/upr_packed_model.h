@@ -0,0 +1,261 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mshadow/base.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace upr {
+
+// The packed model format.
+//
+// A packed model holds the parameters of a model (and optionally its symbol)
+// in a layout that can be used in place once the file is mapped:
+//
+//   header        magic, version, alignment, the number of layers and the
+//                 offset and size of the index, the symbol and the data
+//   index         per layer: name, type flag, shape, offset of the data
+//                 (relative to the data region), byte count and checksum
+//   symbol        the symbol json, if embedded
+//   data          starts at a multiple of the alignment (4KB or 2MB for huge
+//                 pages). every layer starts at a multiple of the layer
+//                 alignment
+//
+// All integers are little endian. Unlike the NDArray::Save format, the data
+// region is contiguous, so the weights of a model can be copied or shared
+// with a single operation, and the page cache backing the mapping is shared
+// by every process that maps the file.
+
+// "UPRPACK1"
+static const uint64_t packed_model_magic   = 0x314b434150525055;
+static const uint32_t packed_model_version = 1;
+
+// 64 bit fnv-1a
+static inline uint64_t packed_checksum(const void *data, size_t byte_count) {
+  uint64_t hash     = 0xcbf29ce484222325;
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  for (size_t ii = 0; ii < byte_count; ii++) {
+    hash ^= bytes[ii];
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+struct packed_layer {
+  std::string name{};
+  int32_t type_flag{0};
+  std::vector<int64_t> shape{};
+  // offset of the data in the data region
+  size_t offset{0};
+  size_t byte_count{0};
+  uint64_t checksum{0};
+};
+
+struct packed_model_index {
+  uint32_t alignment{0};
+  std::vector<packed_layer> layers{};
+  std::string symbol_json{};
+  // offset and size of the data region in the file
+  size_t data_offset{0};
+  size_t data_byte_count{0};
+};
+
+// a layer to be written to a packed model
+struct packed_layer_source {
+  std::string name{};
+  int32_t type_flag{0};
+  std::vector<int64_t> shape{};
+  const void *data{nullptr};
+  size_t byte_count{0};
+};
+
+static inline size_t align_to(size_t value, size_t alignment) {
+  return alignment <= 1 ? value : (value + alignment - 1) / alignment * alignment;
+}
+
+// returns true if the byte_count bytes at data start with a packed model
+// header
+static inline bool is_packed_model(const void *data, size_t byte_count) {
+  uint64_t magic;
+  if (data == nullptr || byte_count < sizeof(magic)) {
+    return false;
+  }
+  memcpy(&magic, data, sizeof(magic));
+  return magic == packed_model_magic;
+}
+
+static inline bool is_packed_model_file(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+  uint64_t magic = 0;
+  in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+  return in.good() && magic == packed_model_magic;
+}
+
+// writes the layers (and the symbol, if not empty) as a packed model
+static inline void write_packed_model(const std::string &path, const std::vector<packed_layer_source> &layers,
+                                      const std::string &symbol_json, size_t alignment = 4096,
+                                      size_t layer_alignment = 256) {
+  if (alignment == 0 || layer_alignment == 0 || alignment % layer_alignment != 0) {
+    throw std::runtime_error("the alignment must be a multiple of the layer alignment");
+  }
+
+  std::string index;
+  const auto append = [&](const void *data, size_t byte_count) {
+    index.append(static_cast<const char *>(data), byte_count);
+  };
+  size_t data_byte_count = 0;
+  for (const auto &layer : layers) {
+    if (layer.byte_count != 0 && layer.data == nullptr) {
+      throw std::runtime_error("the layer " + layer.name + " has no data");
+    }
+    const uint64_t name_length = layer.name.size();
+    const uint32_t ndim        = layer.shape.size();
+    const uint64_t offset      = align_to(data_byte_count, layer_alignment);
+    const uint64_t byte_count  = layer.byte_count;
+    const uint64_t checksum    = packed_checksum(layer.data, layer.byte_count);
+    append(&name_length, sizeof(name_length));
+    append(layer.name.data(), layer.name.size());
+    append(&layer.type_flag, sizeof(layer.type_flag));
+    append(&ndim, sizeof(ndim));
+    append(layer.shape.data(), ndim * sizeof(int64_t));
+    append(&offset, sizeof(offset));
+    append(&byte_count, sizeof(byte_count));
+    append(&checksum, sizeof(checksum));
+    data_byte_count = offset + byte_count;
+  }
+
+  const uint64_t header_byte_count = 10 * sizeof(uint64_t);
+  const uint64_t index_offset      = header_byte_count;
+  const uint64_t symbol_offset     = index_offset + index.size();
+  const uint64_t data_offset       = align_to(symbol_offset + symbol_json.size(), alignment);
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out.is_open()) {
+    throw std::runtime_error("unable to open " + path + " for writing");
+  }
+  const auto write = [&](uint64_t value) { out.write(reinterpret_cast<const char *>(&value), sizeof(value)); };
+  write(packed_model_magic);
+  write((uint64_t{alignment} << 32) | packed_model_version);
+  write(layers.size());
+  write(index_offset);
+  write(index.size());
+  write(symbol_offset);
+  write(symbol_json.size());
+  write(data_offset);
+  write(data_byte_count);
+  write(layer_alignment);
+  out.write(index.data(), index.size());
+  out.write(symbol_json.data(), symbol_json.size());
+
+  const std::vector<char> padding(alignment, 0);
+  size_t position = symbol_offset + symbol_json.size();
+  const auto pad_to = [&](size_t target) {
+    while (position < target) {
+      const auto count = std::min(target - position, padding.size());
+      out.write(padding.data(), count);
+      position += count;
+    }
+  };
+  pad_to(data_offset);
+  size_t offset = 0;
+  for (const auto &layer : layers) {
+    offset = align_to(offset, layer_alignment);
+    pad_to(data_offset + offset);
+    out.write(static_cast<const char *>(layer.data), layer.byte_count);
+    position += layer.byte_count;
+    offset += layer.byte_count;
+  }
+  if (!out.good()) {
+    throw std::runtime_error("failed to write " + path);
+  }
+}
+
+// parses the header and the index of the packed model of byte_count bytes at
+// data. every offset is checked against byte_count
+static inline packed_model_index read_packed_model_index(const void *data, size_t byte_count) {
+  const auto *base = static_cast<const char *>(data);
+  size_t cursor    = 0;
+  const auto read  = [&](void *dst, size_t count) {
+    if (count > byte_count - cursor) {
+      throw std::runtime_error("unexpected end of the packed model");
+    }
+    memcpy(dst, base + cursor, count);
+    cursor += count;
+  };
+  const auto read_u64 = [&]() {
+    uint64_t value;
+    read(&value, sizeof(value));
+    return value;
+  };
+
+  if (read_u64() != packed_model_magic) {
+    throw std::runtime_error("invalid packed model header");
+  }
+  const auto version_and_alignment = read_u64();
+  if ((version_and_alignment & 0xffffffff) != packed_model_version) {
+    throw std::runtime_error("unsupported packed model version " + std::to_string(version_and_alignment & 0xffffffff));
+  }
+  packed_model_index res;
+  res.alignment                = version_and_alignment >> 32;
+  const auto num_layers        = read_u64();
+  const auto index_offset      = read_u64();
+  const auto index_byte_count  = read_u64();
+  const auto symbol_offset     = read_u64();
+  const auto symbol_byte_count = read_u64();
+  res.data_offset              = read_u64();
+  res.data_byte_count          = read_u64();
+  read_u64(); // layer alignment
+
+  const auto in_bounds = [&](uint64_t offset, uint64_t count) {
+    return offset <= byte_count && count <= byte_count - offset;
+  };
+  if (!in_bounds(index_offset, index_byte_count) || !in_bounds(symbol_offset, symbol_byte_count) ||
+      !in_bounds(res.data_offset, res.data_byte_count)) {
+    throw std::runtime_error("the packed model is truncated");
+  }
+  res.symbol_json.assign(base + symbol_offset, symbol_byte_count);
+
+  // the index is parsed within its own bounds
+  cursor = index_offset;
+  byte_count = index_offset + index_byte_count;
+  // every layer takes at least 32 bytes of the index
+  if (num_layers > index_byte_count / 32) {
+    throw std::runtime_error("invalid number of layers in the packed model");
+  }
+  res.layers.resize(num_layers);
+  for (auto &layer : res.layers) {
+    const auto name_length = read_u64();
+    if (name_length > byte_count - cursor) {
+      throw std::runtime_error("unexpected end of the packed model");
+    }
+    layer.name.assign(base + cursor, name_length);
+    cursor += name_length;
+    read(&layer.type_flag, sizeof(layer.type_flag));
+    uint32_t ndim;
+    read(&ndim, sizeof(ndim));
+    if (ndim > (byte_count - cursor) / sizeof(int64_t)) {
+      throw std::runtime_error("unexpected end of the packed model");
+    }
+    layer.shape.resize(ndim);
+    read(layer.shape.data(), ndim * sizeof(int64_t));
+    layer.offset     = read_u64();
+    layer.byte_count = read_u64();
+    layer.checksum   = read_u64();
+
+    size_t num_elements = 1;
+    for (const auto dim : layer.shape) {
+      num_elements *= dim;
+    }
+    if (num_elements * mshadow::mshadow_sizeof(layer.type_flag) != layer.byte_count ||
+        layer.offset > res.data_byte_count || layer.byte_count > res.data_byte_count - layer.offset) {
+      throw std::runtime_error("invalid layer " + layer.name + " in the packed model");
+    }
+  }
+  return res;
+}
+
+} // namespace upr
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "upr_params_mmap.h"
+
+#include <dmlc/logging.h>
+#include <dmlc/parameter.h>
+#include <mxnet/ndarray.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace upr {
+
+// checks the layer checksums of the packed models when they are loaded. off by
+// default, since it reads every weight, which a mapped model otherwise does not
+// do until the weights are used
+static const auto UPR_VERIFY_PACKED_MODELS = dmlc::GetEnv("UPR_VERIFY_PACKED_MODELS", false);
+
+// creates cpu ndarrays from the arrays of a params mapping or a packed model.
+// with copy == false the ndarrays point into the arrays, whose memory must
+// outlive them (and must not be written to)
+static inline void to_ndarrays(const std::vector<mapped_array> &arrays, bool copy, std::vector<mxnet::NDArray> *data,
+                               std::vector<std::string> *names) {
+  data->reserve(arrays.size());
+  names->reserve(arrays.size());
+  for (const auto &array : arrays) {
+    const mxnet::TShape shape(array.shape.begin(), array.shape.end());
+    if (copy) {
+      mxnet::NDArray nd(shape, mxnet::Context::CPU(), false, array.type_flag);
+      nd.SyncCopyFromCPU(array.data, shape.Size());
+      data->emplace_back(nd);
+    } else {
+      const mxnet::TBlob blob((void *) array.data, shape, mxnet::cpu::kDevMask, array.type_flag);
+      data->emplace_back(blob, 0);
+    }
+    names->emplace_back(array.name);
+  }
+}
+
+// loads the arrays of the packed model file at path through a mapping. the
+// ndarrays own a copy of the data. errors are thrown as dmlc::Error, which the
+// c api reports to its caller
+static inline void load_packed_ndarrays(const std::string &path, std::vector<mxnet::NDArray> *data,
+                                        std::vector<std::string> *names) {
+  try {
+    mapped_params_file mapping(path);
+    if (UPR_VERIFY_PACKED_MODELS) {
+      verify_packed_arrays(mapping.arrays());
+    }
+    to_ndarrays(mapping.arrays(), /*copy=*/true, data, names);
+  } catch (const dmlc::Error &) {
+    throw;
+  } catch (const std::runtime_error &error) {
+    throw dmlc::Error(error.what());
+  }
+}
+
+// loads the arrays of the packed model of byte_count bytes at buffer. with
+// copy == false the ndarrays point into buffer
+static inline void load_packed_ndarrays(const void *buffer, size_t byte_count, bool copy,
+                                        std::vector<mxnet::NDArray> *data, std::vector<std::string> *names,
+                                        std::string *symbol_json = nullptr) {
+  try {
+    const auto arrays = read_packed_arrays(static_cast<const char *>(buffer), byte_count, symbol_json);
+    if (UPR_VERIFY_PACKED_MODELS) {
+      verify_packed_arrays(arrays);
+    }
+    to_ndarrays(arrays, copy, data, names);
+  } catch (const dmlc::Error &) {
+    throw;
+  } catch (const std::runtime_error &error) {
+    throw dmlc::Error(error.what());
+  }
+}
+
+} // namespace upr
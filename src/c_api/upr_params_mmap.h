@@ -0,0 +1,266 @@
+#pragma once
+
+#include "upr_packed_model.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace upr {
+
+// one array of a memory mapped params file
+struct mapped_array {
+  std::string name{};
+  std::vector<int64_t> shape{};
+  int32_t type_flag{0};
+  // points into the mapping
+  const char *data{nullptr};
+  size_t byte_count{0};
+  // offset of the data in the file
+  size_t offset{0};
+  // the checksum of the data. only stored in packed models
+  uint64_t checksum{0};
+};
+
+// returns the arrays of the packed model of byte_count bytes at base. the
+// arrays point into base
+static inline std::vector<mapped_array> read_packed_arrays(const char *base, size_t byte_count,
+                                                           std::string *symbol_json = nullptr) {
+  auto index = read_packed_model_index(base, byte_count);
+  std::vector<mapped_array> arrays(index.layers.size());
+  for (size_t ii = 0; ii < arrays.size(); ii++) {
+    auto &layer           = index.layers[ii];
+    arrays[ii].name       = std::move(layer.name);
+    arrays[ii].shape      = std::move(layer.shape);
+    arrays[ii].type_flag  = layer.type_flag;
+    arrays[ii].byte_count = layer.byte_count;
+    arrays[ii].offset     = index.data_offset + layer.offset;
+    arrays[ii].data       = base + arrays[ii].offset;
+    arrays[ii].checksum   = layer.checksum;
+  }
+  if (symbol_json != nullptr) {
+    *symbol_json = std::move(index.symbol_json);
+  }
+  return arrays;
+}
+
+// checks the data of the arrays of a packed model against the checksums of
+// its index. throws a runtime_error on the first mismatch
+static inline void verify_packed_arrays(const std::vector<mapped_array> &arrays) {
+  for (const auto &array : arrays) {
+    if (packed_checksum(array.data, array.byte_count) != array.checksum) {
+      throw std::runtime_error("the checksum of the layer " + array.name + " of the packed model does not match");
+    }
+  }
+}
+
+// A read only memory mapping of a params file (the format written by
+// NDArray::Save for a list of arrays, or a packed model).
+//
+// The header and the per array metadata are parsed in place, and every array
+// points straight into the mapping. this avoids reading the file into
+// temporary cpu arrays before copying the weights to their destination.
+// only dense arrays are supported. the arrays are valid while the mapping is
+// alive
+class mapped_params_file {
+public:
+  explicit mapped_params_file(const std::string &path) : path_(path) {
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+      throw std::runtime_error("unable to open " + path + ". " + strerror(errno));
+    }
+    struct stat sb;
+    if (fstat(fd, &sb) != 0) {
+      close(fd);
+      throw std::runtime_error("unable to stat " + path + ". " + strerror(errno));
+    }
+    size_ = sb.st_size;
+    if (size_ == 0) {
+      close(fd);
+      throw std::runtime_error("the params file " + path + " is empty");
+    }
+    void *base = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+      throw std::runtime_error("unable to map " + path + ". " + strerror(errno));
+    }
+    base_ = static_cast<const char *>(base);
+    // the weights are read once, front to back
+    madvise(base, size_, MADV_SEQUENTIAL);
+    madvise(base, size_, MADV_WILLNEED);
+
+    try {
+      parse();
+    } catch (...) {
+      munmap(const_cast<char *>(base_), size_);
+      throw;
+    }
+  }
+
+  ~mapped_params_file() {
+    munmap(const_cast<char *>(base_), size_);
+  }
+
+  mapped_params_file(const mapped_params_file &) = delete;
+  mapped_params_file &operator=(const mapped_params_file &) = delete;
+
+  const std::vector<mapped_array> &arrays() const {
+    return arrays_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool is_packed() const {
+    return packed_;
+  }
+
+  // the symbol embedded in a packed model. empty otherwise
+  const std::string &symbol_json() const {
+    return symbol_json_;
+  }
+
+  // the number of bytes of the array data
+  size_t byte_count() const {
+    size_t res = 0;
+    for (const auto &array : arrays_) {
+      res += array.byte_count;
+    }
+    return res;
+  }
+
+private:
+  // kMXAPINDArrayListMagic
+  static const uint64_t list_magic = 0x112;
+  // NDARRAY_V1_MAGIC and NDARRAY_V2_MAGIC
+  static const uint32_t ndarray_v1_magic = 0xF993fac8;
+  static const uint32_t ndarray_v2_magic = 0xF993fac9;
+  // kDefaultStorage
+  static const int32_t default_storage = 0;
+
+  template <typename T>
+  T read() {
+    T value;
+    read(&value, sizeof(T));
+    return value;
+  }
+
+  void read(void *dst, size_t byte_count) {
+    const char *src = skip(byte_count);
+    memcpy(dst, src, byte_count);
+  }
+
+  const char *skip(size_t byte_count) {
+    if (byte_count > size_ - cursor_) {
+      throw std::runtime_error("unexpected end of the params file " + path_);
+    }
+    const char *res = base_ + cursor_;
+    cursor_ += byte_count;
+    return res;
+  }
+
+  void check_remaining(size_t count, size_t element_size) const {
+    if (count > (size_ - cursor_) / element_size) {
+      throw std::runtime_error("unexpected end of the params file " + path_);
+    }
+  }
+
+  std::vector<int64_t> read_shape() {
+    const auto ndim = read<uint32_t>();
+    check_remaining(ndim, sizeof(int64_t));
+    std::vector<int64_t> shape(ndim);
+    read(shape.data(), ndim * sizeof(int64_t));
+    return shape;
+  }
+
+  // the shapes of files written before the v1 format start with ndim and
+  // have 32 bit dimensions
+  std::vector<int64_t> read_legacy_shape(uint32_t ndim) {
+    check_remaining(ndim, sizeof(uint32_t));
+    std::vector<uint32_t> dims(ndim);
+    read(dims.data(), ndim * sizeof(uint32_t));
+    return std::vector<int64_t>(dims.begin(), dims.end());
+  }
+
+  void parse_array(mapped_array *array) {
+    const auto magic = read<uint32_t>();
+    if (magic == ndarray_v2_magic) {
+      const auto stype = read<int32_t>();
+      if (stype != default_storage) {
+        throw std::runtime_error("sparse arrays cannot be memory mapped");
+      }
+      array->shape = read_shape();
+    } else if (magic == ndarray_v1_magic) {
+      array->shape = read_shape();
+    } else {
+      array->shape = read_legacy_shape(magic);
+    }
+    if (array->shape.empty()) {
+      // a none array has no context, type or data
+      return;
+    }
+    // the context the array was saved from
+    read<int32_t>();
+    read<int32_t>();
+    array->type_flag = read<int32_t>();
+
+    size_t num_elements = 1;
+    for (const auto dim : array->shape) {
+      num_elements *= dim;
+    }
+    array->byte_count = num_elements * mshadow::mshadow_sizeof(array->type_flag);
+    array->offset     = cursor_;
+    array->data       = skip(array->byte_count);
+  }
+
+  void parse_packed() {
+    packed_ = true;
+    arrays_ = read_packed_arrays(base_, size_, &symbol_json_);
+  }
+
+  void parse() {
+    if (is_packed_model(base_, size_)) {
+      parse_packed();
+      return;
+    }
+    if (read<uint64_t>() != list_magic) {
+      throw std::runtime_error("invalid header in the params file " + path_);
+    }
+    read<uint64_t>(); // reserved
+
+    const auto num_arrays = read<uint64_t>();
+    check_remaining(num_arrays, sizeof(uint32_t));
+    arrays_.resize(num_arrays);
+    for (auto &array : arrays_) {
+      parse_array(&array);
+    }
+
+    const auto num_names = read<uint64_t>();
+    if (num_names != 0 && num_names != num_arrays) {
+      throw std::runtime_error("invalid number of names in the params file " + path_);
+    }
+    for (uint64_t ii = 0; ii < num_names; ii++) {
+      const auto length = read<uint64_t>();
+      const char *name  = skip(length);
+      arrays_[ii].name.assign(name, length);
+    }
+  }
+
+  std::string path_{};
+  const char *base_{nullptr};
+  size_t size_{0};
+  size_t cursor_{0};
+  bool packed_{false};
+  std::string symbol_json_{};
+  std::vector<mapped_array> arrays_{};
+};
+
+} // namespace upr
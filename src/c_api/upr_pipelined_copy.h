@@ -0,0 +1,264 @@
+#pragma once
+
+#include "upr_params_mmap.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <cuda_runtime_api.h>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace upr {
+
+// Copies the arrays of a mapped params file (or any other source that can
+// produce a byte range on demand) into a packed device buffer.
+//
+// The destination is split into fixed size chunks. io threads read the
+// chunks from the mapping (which is where the file is read from disk) into a
+// ring of pinned staging buffers, while the calling thread issues the host to
+// device copy of every staged chunk. a staging buffer is refilled once the
+// copy out of it completes, so reading, staging and transferring overlap.
+class pipelined_copy {
+public:
+  struct options {
+    size_t chunk_byte_count{8 * 1024 * 1024};
+    int num_io_threads{4};
+    // staging buffers per io thread. 2 double buffers every thread
+    int buffers_per_thread{2};
+  };
+
+  // called when a stage of a chunk starts ("read_chunk" or
+  // "transfer_chunk"). the returned function is called when it ends
+  using stage_tracer = std::function<std::function<void()>(const char *stage, size_t chunk)>;
+
+  // per stage timings, in microseconds
+  struct timings {
+    // time spent reading chunks into the staging buffers, summed over the io threads
+    int64_t read{0};
+    // time the transfers were stalled waiting for a chunk to be staged
+    int64_t wait_for_read{0};
+    // time spent waiting for the outstanding transfers once every chunk was issued
+    int64_t transfer{0};
+  };
+
+  // fills dst with the bytes [begin, begin + byte_count) of the source. called
+  // concurrently from the io threads
+  using stage_fn = std::function<void(size_t begin, size_t byte_count, char *dst)>;
+
+  // copies the arrays of params back to back
+  pipelined_copy(const mapped_params_file &params, const options &opts) : params_(&params), opts_(opts) {
+    size_t offset = 0;
+    for (const auto &array : params_->arrays()) {
+      offsets_.emplace_back(offset);
+      offset += array.byte_count;
+    }
+    byte_count_ = offset;
+    stage_      = [this](size_t begin, size_t byte_count, char *dst) { stage_mapped(begin, byte_count, dst); };
+  }
+
+  // copies the byte_count bytes produced by stage
+  pipelined_copy(size_t byte_count, stage_fn stage, const options &opts)
+      : opts_(opts), byte_count_(byte_count), stage_(std::move(stage)) {
+  }
+
+  pipelined_copy(const pipelined_copy &) = delete;
+  pipelined_copy &operator=(const pipelined_copy &) = delete;
+
+  size_t byte_count() const {
+    return byte_count_;
+  }
+
+  // copies the arrays back to back into device_ptr, which must hold
+  // byte_count() bytes. returns once the copy is complete
+  timings run(void *device_ptr, cudaStream_t stream, const stage_tracer &trace = nullptr) {
+    const auto begin_stage = [&](const char *stage, size_t chunk) -> std::function<void()> {
+      return trace ? trace(stage, chunk) : nullptr;
+    };
+    const auto end_stage = [](const std::function<void()> &end) {
+      if (end) {
+        end();
+      }
+    };
+
+    const size_t chunk_byte_count = std::max(opts_.chunk_byte_count, size_t{1});
+    const size_t num_chunks       = (byte_count_ + chunk_byte_count - 1) / chunk_byte_count;
+    if (num_chunks == 0) {
+      return timings{};
+    }
+    const int num_threads = std::max(1, std::min<int>(opts_.num_io_threads, num_chunks));
+    const size_t num_slots =
+        std::min<size_t>(num_chunks, static_cast<size_t>(num_threads) * std::max(opts_.buffers_per_thread, 1));
+
+    std::vector<slot> slots(num_slots);
+    const auto free_slots = [&]() {
+      for (auto &s : slots) {
+        if (s.copied != nullptr) {
+          cudaEventDestroy(s.copied);
+        }
+        if (s.buffer != nullptr) {
+          cudaFreeHost(s.buffer);
+        }
+      }
+    };
+    try {
+      for (auto &s : slots) {
+        check(cudaMallocHost(&s.buffer, chunk_byte_count), "failed to allocate a staging buffer");
+        check(cudaEventCreateWithFlags(&s.copied, cudaEventDisableTiming), "failed to create a staging event");
+      }
+    } catch (...) {
+      free_slots();
+      throw;
+    }
+
+    timings res;
+    std::vector<std::thread> readers;
+    for (int ii = 0; ii < num_threads; ii++) {
+      readers.emplace_back([&, ii]() {
+        // every reader handles the chunks ii, ii + num_threads, ...
+        for (size_t chunk = ii; chunk < num_chunks; chunk += num_threads) {
+          auto &s = slots[chunk % num_slots];
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&]() { return failed_ || chunk < num_slots || s.issued == chunk - num_slots; });
+            if (failed_) {
+              return;
+            }
+          }
+          // the copy out of the buffer was issued. wait for it to finish
+          // before overwriting the buffer
+          if (chunk >= num_slots && cudaEventSynchronize(s.copied) != cudaSuccess) {
+            fail();
+            return;
+          }
+          const auto start = std::chrono::steady_clock::now();
+          const auto end   = begin_stage("read_chunk", chunk);
+          const auto begin = chunk * chunk_byte_count;
+          const auto size  = std::min(chunk_byte_count, byte_count_ - begin);
+          try {
+            stage_(begin, size, (char *) s.buffer);
+          } catch (...) {
+            end_stage(end);
+            fail();
+            return;
+          }
+          end_stage(end);
+          const auto read = elapsed(start);
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            s.staged       = chunk;
+            s.staged_bytes = size;
+            res.read += read;
+          }
+          cv_.notify_all();
+        }
+      });
+    }
+
+    bool ok = true;
+    for (size_t chunk = 0; chunk < num_chunks && ok; chunk++) {
+      auto &s          = slots[chunk % num_slots];
+      const auto start = std::chrono::steady_clock::now();
+      size_t size      = 0;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&]() { return failed_ || s.staged == chunk; });
+        if (failed_) {
+          ok = false;
+          break;
+        }
+        size = s.staged_bytes;
+      }
+      res.wait_for_read += elapsed(start);
+
+      // the span covers issuing the copy. the copy itself completes
+      // asynchronously on the stream
+      const auto end = begin_stage("transfer_chunk", chunk);
+      const auto dst = ((char *) device_ptr) + chunk * chunk_byte_count;
+      ok             = cudaMemcpyAsync(dst, s.buffer, size, cudaMemcpyHostToDevice, stream) == cudaSuccess &&
+           cudaEventRecord(s.copied, stream) == cudaSuccess;
+      end_stage(end);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        s.issued = chunk;
+        failed_  = failed_ || !ok;
+      }
+      cv_.notify_all();
+    }
+
+    for (auto &reader : readers) {
+      reader.join();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    ok               = cudaStreamSynchronize(stream) == cudaSuccess && ok && !failed_;
+    res.transfer     = elapsed(start);
+
+    free_slots();
+    if (!ok) {
+      throw std::runtime_error("failed to copy the params to the device");
+    }
+    return res;
+  }
+
+private:
+  static constexpr size_t none = static_cast<size_t>(-1);
+
+  struct slot {
+    void *buffer{nullptr};
+    cudaEvent_t copied{nullptr};
+    // the chunk that is staged in the buffer
+    size_t staged{none};
+    size_t staged_bytes{0};
+    // the chunk whose copy out of the buffer was issued
+    size_t issued{none};
+  };
+
+  static void check(cudaError_t err, const std::string &msg) {
+    if (err != cudaSuccess) {
+      throw std::runtime_error(msg + ". " + cudaGetErrorString(err));
+    }
+  }
+
+  static int64_t elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void fail() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      failed_ = true;
+    }
+    cv_.notify_all();
+  }
+
+  // copies the packed range [begin, begin + size) from the mapping into dst
+  void stage_mapped(size_t begin, size_t size, char *dst) const {
+    const size_t end = begin + size;
+    // the last array that starts at or before begin
+    auto ii = std::upper_bound(offsets_.begin(), offsets_.end(), begin) - offsets_.begin() - 1;
+    for (auto pos = begin; pos < end; ii++) {
+      const auto &array = params_->arrays()[ii];
+      const auto from   = pos - offsets_[ii];
+      const auto count  = std::min(array.byte_count - from, end - pos);
+      memcpy(dst + (pos - begin), array.data + from, count);
+      pos += count;
+    }
+  }
+
+  const mapped_params_file *params_{nullptr};
+  const options opts_;
+  std::vector<size_t> offsets_{};
+  size_t byte_count_{0};
+  stage_fn stage_{};
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool failed_{false};
+};
+
+} // namespace upr
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../executor/exec_pass.h"
+
+#include <mxnet/ndarray.h>
+#include <nnvm/graph.h>
+#include <nnvm/pass_functions.h>
+#include <nnvm/symbolic.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace upr {
+
+// loads symbol_json (upgrading legacy graphs) and infers the shapes and types
+// of every entry when input_name has the shape input_shape. the types that
+// cannot be inferred are left as -1. throws if the shapes cannot be inferred
+static inline nnvm::Graph infer_graph(const std::string &symbol_json, const std::string &input_name,
+                                      const mxnet::TShape &input_shape) {
+  nnvm::Graph graph;
+  {
+    nnvm::Graph g;
+    g.attrs["json"] = std::make_shared<nnvm::any>(symbol_json);
+    graph.outputs   = nnvm::ApplyPass(g, "LoadLegacyJSON").outputs;
+  }
+
+  const auto num_inputs = graph.indexed_graph().input_nodes().size();
+  nnvm::ShapeVector in_shapes(num_inputs, mxnet::TShape());
+  nnvm::DTypeVector in_types(num_inputs, mshadow::kFloat32);
+  bool found_input = false;
+  for (size_t ii = 0; ii < num_inputs; ii++) {
+    const auto &idx = graph.indexed_graph();
+    if (idx[idx.input_nodes()[ii]].source->attrs.name == input_name) {
+      in_shapes[ii] = input_shape;
+      found_input   = true;
+    }
+  }
+  if (!found_input) {
+    throw std::runtime_error("the graph does not have an input named " + input_name);
+  }
+
+  graph = mxnet::exec::InferShape(std::move(graph), std::move(in_shapes), "__shape__");
+  if (graph.GetAttr<size_t>("shape_num_unknown_nodes") != 0) {
+    throw std::runtime_error("unable to infer the shapes of the graph");
+  }
+  graph = mxnet::exec::InferType(std::move(graph), std::move(in_types), "__dtype__");
+  return graph;
+}
+
+// A prepared graph is the graph of a model for one input shape, saved as
+// nnvm json with the inferred "shape" and "dtype" attributes. uprd prepares it
+// once per model and input shape, and clients load it with LoadJSON instead of
+// running LoadLegacyJSON and the shape inference themselves.
+//
+// The memory plan is not part of it. it is computed by Executor::Bind on the
+// graph the executor builds, which is not the graph saved here.
+static inline std::string prepare_graph_json(const std::string &symbol_json, const std::string &input_name,
+                                             const mxnet::TShape &input_shape) {
+  const auto inferred = infer_graph(symbol_json, input_name, input_shape);
+
+  nnvm::Graph graph;
+  graph.outputs        = inferred.outputs;
+  graph.attrs["shape"] = inferred.attrs.at("shape");
+  graph.attrs["dtype"] = inferred.attrs.at("dtype");
+  graph                = nnvm::ApplyPass(std::move(graph), "SaveJSON");
+  return graph.GetAttr<std::string>("json");
+}
+
+// loads a prepared graph. the shape attribute is indexed by the entries of
+// the indexed graph of the result
+static inline nnvm::Graph load_prepared_graph(const std::string &graph_json) {
+  nnvm::Graph g;
+  g.attrs["json"] = std::make_shared<nnvm::any>(graph_json);
+  g               = nnvm::ApplyPass(std::move(g), "LoadJSON");
+  if (g.attrs.count("shape") == 0) {
+    throw std::runtime_error("the graph was not prepared. it has no shapes");
+  }
+  const auto &shapes = g.GetAttr<nnvm::ShapeVector>("shape");
+  if (shapes.size() != g.indexed_graph().num_node_entries()) {
+    throw std::runtime_error("the shapes of the prepared graph do not match its entries");
+  }
+  return g;
+}
+
+} // namespace upr
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "upr_digest.h"
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace upr {
+
+// builds the key of a predictor template: the digest of the symbol json, the
+// selected outputs, the input shapes (in the order given) and the context.
+// shapes are passed as indptr/data as in MXPredCreate
+static inline std::string to_template_key(const std::string &symbol_json, const std::vector<std::string> &output_keys,
+                                          const std::vector<std::string> &input_keys,
+                                          const uint32_t *input_shape_indptr, const uint32_t *input_shape_data,
+                                          int dev_type, int dev_id) {
+  std::string key = digest_layer(symbol_json.data(), symbol_json.size()).str();
+  for (const auto &output_key : output_keys) {
+    key += "|o:" + output_key;
+  }
+  for (size_t ii = 0; ii < input_keys.size(); ii++) {
+    key += "|i:" + input_keys[ii] + "(";
+    for (auto jj = input_shape_indptr[ii]; jj < input_shape_indptr[ii + 1]; jj++) {
+      key += std::to_string(input_shape_data[jj]) + ",";
+    }
+    key += ")";
+  }
+  key += "|ctx:" + std::to_string(dev_type) + ":" + std::to_string(dev_id);
+  return key;
+}
+
+// A bounded, process wide cache of immutable templates (the parts of a
+// predictor that only depend on the symbol, the input shapes and the context).
+//
+// Templates are shared with the predictors created from them, so an entry
+// evicted while in use stays alive until its last predictor is freed. A
+// capacity of 0 disables the cache.
+template <typename T>
+class template_cache {
+public:
+  using build_fn = std::function<std::shared_ptr<const T>()>;
+
+  explicit template_cache(size_t capacity) : capacity_(capacity) {
+  }
+
+  // returns the template for key, calling build (without holding the cache
+  // lock) on a miss. hit is set if the template was found
+  std::shared_ptr<const T> get_or_build(const std::string &key, const build_fn &build, bool *hit = nullptr) {
+    if (capacity_ != 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        order_.splice(order_.begin(), order_, it->second.position);
+        hits_++;
+        if (hit != nullptr) {
+          *hit = true;
+        }
+        return it->second.value;
+      }
+      misses_++;
+    }
+    if (hit != nullptr) {
+      *hit = false;
+    }
+
+    auto value = build();
+    if (capacity_ == 0 || value == nullptr) {
+      return value;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      // built concurrently. keep the first one
+      return it->second.value;
+    }
+    order_.emplace_front(key);
+    entries_.emplace(key, entry{value, order_.begin()});
+    while (entries_.size() > capacity_) {
+      entries_.erase(order_.back());
+      order_.pop_back();
+    }
+    return value;
+  }
+
+  // returns the template for key, or nullptr if it is not cached. does not
+  // count as a hit or a miss
+  std::shared_ptr<const T> find(const std::string &key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    return it == entries_.end() ? nullptr : it->second.value;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    order_.clear();
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  uint64_t hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+  uint64_t misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+  }
+
+private:
+  struct entry {
+    std::shared_ptr<const T> value;
+    std::list<std::string>::iterator position;
+  };
+
+  const size_t capacity_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, entry> entries_{};
+  // most recently used first
+  std::list<std::string> order_{};
+  uint64_t hits_{0};
+  uint64_t misses_{0};
+};
+
+} // namespace upr
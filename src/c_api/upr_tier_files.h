@@ -0,0 +1,386 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+namespace upr {
+
+struct tier_file_layer {
+  std::string name{};
+  std::vector<int64_t> shape{};
+  // offset of the layer in the segment
+  size_t offset{0};
+  size_t byte_count{0};
+};
+
+// describes the content of a segment of the cpu tier
+struct tier_file_index {
+  std::string model_name{};
+  // identifies the version of the model the segment was copied from, so that
+  // the segment of a model that changed since is not restored
+  std::string source_version{};
+  size_t byte_count{0};
+  std::vector<tier_file_layer> layers{};
+};
+
+// the index is a text file. the names are the last field of their line, so
+// they may hold spaces
+//
+//   upr-tier 1
+//   model <model_name>
+//   source <source_version>
+//   byte_count <byte_count>
+//   layers <num_layers>
+//   <offset> <byte_count> <ndim> <dim>... <name>
+static inline std::string to_tier_file_index_text(const tier_file_index &index) {
+  std::ostringstream out;
+  out << "upr-tier 1\n";
+  out << "model " << index.model_name << "\n";
+  out << "source " << index.source_version << "\n";
+  out << "byte_count " << index.byte_count << "\n";
+  out << "layers " << index.layers.size() << "\n";
+  for (const auto &layer : index.layers) {
+    out << layer.offset << " " << layer.byte_count << " " << layer.shape.size();
+    for (const auto dim : layer.shape) {
+      out << " " << dim;
+    }
+    out << " " << layer.name << "\n";
+  }
+  return out.str();
+}
+
+// throws a runtime_error if the text is not a valid index
+static inline tier_file_index parse_tier_file_index(const std::string &text) {
+  // every line, including the last one, ends with a newline
+  if (text.empty() || text.back() != '\n') {
+    throw std::runtime_error("the index of the cpu tier segment is truncated");
+  }
+  std::istringstream in(text);
+  std::string line;
+  const auto next_field = [&](const std::string &key) {
+    if (!std::getline(in, line) || line.compare(0, key.size() + 1, key + " ") != 0) {
+      throw std::runtime_error("expecting " + key + " in the index of the cpu tier segment");
+    }
+    return line.substr(key.size() + 1);
+  };
+  const auto to_size = [](const std::string &value) -> size_t {
+    size_t pos     = 0;
+    const auto res = std::stoull(value, &pos);
+    if (pos != value.size()) {
+      throw std::runtime_error("invalid number " + value + " in the index of the cpu tier segment");
+    }
+    return res;
+  };
+
+  try {
+    if (next_field("upr-tier") != "1") {
+      throw std::runtime_error("unsupported version of the index of the cpu tier segment");
+    }
+    tier_file_index index;
+    index.model_name      = next_field("model");
+    index.source_version  = next_field("source");
+    index.byte_count      = to_size(next_field("byte_count"));
+    const auto num_layers = to_size(next_field("layers"));
+    for (size_t ii = 0; ii < num_layers; ii++) {
+      if (!std::getline(in, line)) {
+        throw std::runtime_error("the index of the cpu tier segment is truncated");
+      }
+      std::istringstream fields(line);
+      tier_file_layer layer;
+      size_t ndim = 0;
+      if (!(fields >> layer.offset >> layer.byte_count >> ndim)) {
+        throw std::runtime_error("invalid layer in the index of the cpu tier segment");
+      }
+      layer.shape.resize(ndim);
+      for (auto &dim : layer.shape) {
+        if (!(fields >> dim)) {
+          throw std::runtime_error("invalid shape in the index of the cpu tier segment");
+        }
+      }
+      fields.get();
+      std::getline(fields, layer.name);
+      if (layer.name.empty()) {
+        throw std::runtime_error("a layer has no name in the index of the cpu tier segment");
+      }
+      if (layer.offset + layer.byte_count < layer.offset || layer.offset + layer.byte_count > index.byte_count) {
+        throw std::runtime_error("the layer " + layer.name + " is out of the cpu tier segment");
+      }
+      index.layers.emplace_back(std::move(layer));
+    }
+    return index;
+  } catch (const std::logic_error &error) {
+    // thrown by stoull
+    throw std::runtime_error(std::string("invalid index of the cpu tier segment. ") + error.what());
+  }
+}
+
+// a segment found by tier_file_store::restore
+struct tier_file_segment {
+  void *base_ptr{nullptr};
+  tier_file_index index{};
+};
+
+// Backs the host copies of the models by files of a directory, typically on a
+// tmpfs or hugetlbfs mount, so that they outlive the process.
+//
+// A segment is a shared mapping of a <name>.tier file. Once its content is
+// written, commit writes its index to <name>.index, through a temporary file
+// that is renamed, so only the segments that were completely written have an
+// index. release unmaps a segment and removes its files, while the destructor
+// only unmaps the segments. A store opened on the same directory later (e.g.
+// by the next run of uprd) maps the committed segments again with restore, and
+// removes the others.
+class tier_file_store {
+public:
+  explicit tier_file_store(std::string directory) : directory_(std::move(directory)) {
+    struct stat sb;
+    if (stat(directory_.c_str(), &sb) != 0 || !S_ISDIR(sb.st_mode)) {
+      throw std::runtime_error("the cpu tier directory " + directory_ + " does not exist");
+    }
+    struct statfs fs;
+    // the files of a hugetlbfs mount are sized in huge pages
+    block_size_ = statfs(directory_.c_str(), &fs) == 0 && fs.f_bsize > 0 ? fs.f_bsize : 4096;
+  }
+
+  tier_file_store(const tier_file_store &) = delete;
+  tier_file_store &operator=(const tier_file_store &) = delete;
+
+  ~tier_file_store() {
+    for (const auto &entry : segments_) {
+      munmap(entry.first, entry.second.mapped_byte_count);
+    }
+  }
+
+  const std::string &directory() const {
+    return directory_;
+  }
+
+  // maps a new segment of byte_count bytes. throws a runtime_error if the
+  // file cannot be created or mapped
+  void *allocate(const std::string &model_name, size_t byte_count) {
+    const auto path = directory_ + "/" + to_file_name(model_name) + ".tier";
+    const int fd    = open(path.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+    if (fd == -1) {
+      throw std::runtime_error("unable to create " + path + ". " + strerror(errno));
+    }
+    const auto mapped_byte_count = round_up(byte_count);
+    if (ftruncate(fd, mapped_byte_count) != 0) {
+      const auto msg = "unable to resize " + path + ". " + strerror(errno);
+      close(fd);
+      unlink(path.c_str());
+      throw std::runtime_error(msg);
+    }
+    void *ptr = mmap(nullptr, mapped_byte_count, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+      unlink(path.c_str());
+      throw std::runtime_error("unable to map " + path + ". " + strerror(errno));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    segments_[ptr] = segment{path, mapped_byte_count};
+    return ptr;
+  }
+
+  // makes the segment at ptr restorable. its content must be fully written
+  void commit(void *ptr, const tier_file_index &index) {
+    const auto path     = index_path(path_of(ptr));
+    const auto tmp_path = path + ".tmp";
+    {
+      std::ofstream out(tmp_path, std::ios::trunc);
+      out << to_tier_file_index_text(index);
+      if (!out) {
+        unlink(tmp_path.c_str());
+        throw std::runtime_error("unable to write " + tmp_path);
+      }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+      unlink(tmp_path.c_str());
+      throw std::runtime_error("unable to rename " + tmp_path + " to " + path);
+    }
+  }
+
+  // unmaps the segment at ptr and removes its files
+  void release(void *ptr) {
+    segment s;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = segments_.find(ptr);
+      if (it == segments_.end()) {
+        throw std::runtime_error("the pointer is not a segment of the cpu tier directory");
+      }
+      s = it->second;
+      segments_.erase(it);
+    }
+    // the index goes first, so a crash in between leaves no index without data
+    unlink(index_path(s.path).c_str());
+    unlink(s.path.c_str());
+    munmap(ptr, s.mapped_byte_count);
+  }
+
+  bool contains(void *ptr) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return segments_.count(ptr) != 0;
+  }
+
+  // the number of mapped segments
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return segments_.size();
+  }
+
+  // maps the committed segments of the directory that are not mapped yet, and
+  // removes the files of the segments that were never committed
+  std::vector<tier_file_segment> restore() {
+    std::vector<std::string> names{};
+    DIR *dir = opendir(directory_.c_str());
+    if (dir == nullptr) {
+      throw std::runtime_error("unable to list " + directory_ + ". " + strerror(errno));
+    }
+    while (auto entry = readdir(dir)) {
+      names.emplace_back(entry->d_name);
+    }
+    closedir(dir);
+
+    std::vector<tier_file_segment> res{};
+    for (const auto &name : names) {
+      const auto path = directory_ + "/" + name;
+      if (ends_with(name, ".index.tmp")) {
+        unlink(path.c_str());
+        continue;
+      }
+      if (ends_with(name, ".index")) {
+        // an index whose segment was removed
+        const auto data_path = path.substr(0, path.size() - std::strlen(".index")) + ".tier";
+        if (access(data_path.c_str(), F_OK) != 0) {
+          unlink(path.c_str());
+        }
+        continue;
+      }
+      if (!ends_with(name, ".tier") || is_mapped(path)) {
+        continue;
+      }
+      tier_file_segment restored;
+      if (!map_committed(path, &restored)) {
+        unlink(index_path(path).c_str());
+        unlink(path.c_str());
+        continue;
+      }
+      res.emplace_back(std::move(restored));
+    }
+    return res;
+  }
+
+private:
+  struct segment {
+    std::string path{};
+    size_t mapped_byte_count{0};
+  };
+
+  static bool ends_with(const std::string &value, const std::string &suffix) {
+    return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+  }
+
+  // <path without .tier>.index
+  static std::string index_path(const std::string &path) {
+    return path.substr(0, path.size() - std::strlen(".tier")) + ".index";
+  }
+
+  // the model name, restricted to characters that are safe in a file name,
+  // and a random suffix
+  static std::string to_file_name(const std::string &model_name) {
+    std::string res{};
+    for (const auto c : model_name) {
+      res += (isalnum(c) || c == '-' || c == '_' || c == '.') ? c : '_';
+    }
+    static std::mutex rand_mutex;
+    static std::random_device rand;
+    std::lock_guard<std::mutex> lock(rand_mutex);
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), "-%08x%08x", rand(), rand());
+    return res + suffix;
+  }
+
+  size_t round_up(size_t byte_count) const {
+    return std::max<size_t>((byte_count + block_size_ - 1) / block_size_, 1) * block_size_;
+  }
+
+  std::string path_of(void *ptr) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = segments_.find(ptr);
+    if (it == segments_.end()) {
+      throw std::runtime_error("the pointer is not a segment of the cpu tier directory");
+    }
+    return it->second.path;
+  }
+
+  bool is_mapped(const std::string &path) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &entry : segments_) {
+      if (entry.second.path == path) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // returns false if the segment at path has no valid index
+  bool map_committed(const std::string &path, tier_file_segment *restored) {
+    std::ifstream in(index_path(path));
+    if (!in.is_open()) {
+      return false;
+    }
+    const std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    try {
+      restored->index = parse_tier_file_index(text);
+    } catch (const std::runtime_error &) {
+      return false;
+    }
+
+    const int fd = open(path.c_str(), O_RDWR | O_CLOEXEC);
+    if (fd == -1) {
+      return false;
+    }
+    struct stat sb;
+    if (fstat(fd, &sb) != 0 || static_cast<size_t>(sb.st_size) < restored->index.byte_count || sb.st_size == 0) {
+      close(fd);
+      return false;
+    }
+    const size_t mapped_byte_count = sb.st_size;
+    void *ptr = mmap(nullptr, mapped_byte_count, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+      return false;
+    }
+    restored->base_ptr = ptr;
+    std::lock_guard<std::mutex> lock(mutex_);
+    segments_[ptr] = segment{path, mapped_byte_count};
+    return true;
+  }
+
+  const std::string directory_;
+  size_t block_size_{4096};
+  mutable std::mutex mutex_;
+  // keyed by the address of the mapping
+  std::unordered_map<void *, segment> segments_{};
+};
+
+} // namespace upr
@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_batcher_test.cc
+ * \brief tests for the request batcher of the batching predictor
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "c_api/upr_batcher.h"
+
+namespace {
+
+// doubles every input and records the batch sizes
+struct doubler {
+  std::mutex mutex;
+  std::vector<size_t> batch_sizes;
+
+  void operator()(const std::vector<upr::request_batcher::request> &requests) {
+    for (const auto &req : requests) {
+      *req.output = 2 * *req.input;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    batch_sizes.emplace_back(requests.size());
+  }
+};
+
+}  // namespace
+
+TEST(UprBatcher, PreparedBatchSizes) {
+  EXPECT_EQ(upr::to_prepared_batch_sizes(1), std::vector<size_t>({1}));
+  EXPECT_EQ(upr::to_prepared_batch_sizes(8), std::vector<size_t>({1, 2, 4, 8}));
+  EXPECT_EQ(upr::to_prepared_batch_sizes(12), std::vector<size_t>({1, 2, 4, 8, 12}));
+
+  const auto sizes = upr::to_prepared_batch_sizes(12);
+  EXPECT_EQ(upr::to_prepared_batch_size(sizes, 1), 1u);
+  EXPECT_EQ(upr::to_prepared_batch_size(sizes, 3), 4u);
+  EXPECT_EQ(upr::to_prepared_batch_size(sizes, 9), 12u);
+  EXPECT_THROW(upr::to_prepared_batch_size(sizes, 13), std::runtime_error);
+}
+
+TEST(UprBatcher, CoalescesConcurrentRequests) {
+  doubler run;
+  const size_t num_requests = 64;
+  std::vector<float> outputs(num_requests, 0);
+  {
+    // a long delay, so the batches are only formed when full
+    upr::request_batcher batcher(8, std::chrono::seconds(10), std::ref(run));
+    std::vector<std::thread> clients;
+    for (size_t ii = 0; ii < num_requests; ii++) {
+      clients.emplace_back([&, ii]() {
+        const float input = ii;
+        batcher.predict(&input, &outputs[ii]);
+      });
+    }
+    for (auto &client : clients) {
+      client.join();
+    }
+    EXPECT_EQ(batcher.num_requests(), num_requests);
+    EXPECT_EQ(batcher.num_batches(), num_requests / 8);
+  }
+  for (size_t ii = 0; ii < num_requests; ii++) {
+    EXPECT_EQ(outputs[ii], 2.0f * ii);
+  }
+  for (const auto size : run.batch_sizes) {
+    EXPECT_EQ(size, 8u);
+  }
+}
+
+TEST(UprBatcher, RunsPartialBatchesAfterTheDelay) {
+  doubler run;
+  upr::request_batcher batcher(8, std::chrono::milliseconds(1), std::ref(run));
+  const float input = 21;
+  float output      = 0;
+  batcher.predict(&input, &output);
+  EXPECT_EQ(output, 42);
+  EXPECT_EQ(run.batch_sizes, std::vector<size_t>({1}));
+}
+
+TEST(UprBatcher, ReportsFailedBatches) {
+  upr::request_batcher batcher(4, std::chrono::microseconds(0), [](const std::vector<upr::request_batcher::request> &) {
+    throw std::runtime_error("out of memory");
+  });
+  const float input = 1;
+  float output      = 0;
+  EXPECT_THROW(batcher.predict(&input, &output), std::runtime_error);
+}
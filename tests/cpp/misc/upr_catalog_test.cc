@@ -0,0 +1,104 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_catalog_test.cc
+ * \brief tests for the uprd model catalog
+ */
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include "c_api/upr_catalog.h"
+
+namespace {
+
+void write_file(const std::string &path, const std::string &content) {
+  std::ofstream out(path);
+  out << content;
+}
+
+std::string make_model(const std::string &base, const std::string &name, const std::string &params_file,
+                       const std::string &symbol_file) {
+  const auto dir = base + "/" + name;
+  mkdir(dir.c_str(), 0755);
+  write_file(dir + "/" + params_file, "0123456789");
+  write_file(dir + "/" + symbol_file, "{}");
+  return dir;
+}
+
+}  // namespace
+
+TEST(UprCatalog, ScansModelDirectories) {
+  char base_template[] = "/tmp/upr_catalog_XXXXXX";
+  const std::string base(mkdtemp(base_template));
+
+  make_model(base, "resnet", "model.params", "model.symbol");
+  make_model(base, "vgg", "vgg-0000.params", "vgg-symbol.json");
+  // a directory without a symbol file is not a model
+  mkdir((base + "/partial").c_str(), 0755);
+  write_file(base + "/partial/model.params", "0");
+
+  upr::model_catalog catalog;
+  catalog.scan(base);
+  EXPECT_EQ(catalog.size(), 2U);
+
+  upr::catalog_entry entry;
+  ASSERT_TRUE(catalog.find("vgg", &entry));
+  EXPECT_EQ(entry.params_path, base + "/vgg/vgg-0000.params");
+  EXPECT_EQ(entry.symbol_path, base + "/vgg/vgg-symbol.json");
+  EXPECT_EQ(entry.byte_count, 10U);
+  EXPECT_FALSE(catalog.find("partial", &entry));
+
+  // models added later are picked up by the next scan
+  make_model(base, "alexnet", "alexnet.params", "alexnet.symbol");
+  catalog.scan(base);
+  EXPECT_TRUE(catalog.find("alexnet", &entry));
+}
+
+TEST(UprCatalog, ManifestDeclaresShapes) {
+  char base_template[] = "/tmp/upr_catalog_XXXXXX";
+  const std::string base(mkdtemp(base_template));
+  char other_template[] = "/tmp/upr_catalog_XXXXXX";
+  const std::string other(mkdtemp(other_template));
+
+  make_model(base, "resnet", "model.params", "model.symbol");
+  const auto squeezenet_dir = make_model(other, "squeezenet", "model.params", "model.symbol");
+  write_file(base + "/manifest", "# name,directory,input_shape,checksum\n"
+                                 "resnet,resnet,1x3x299x299,abc\n"
+                                 "squeezenet_1.1," + squeezenet_dir + "\n");
+
+  upr::model_catalog catalog;
+  catalog.scan(base);
+  catalog.load_manifest(base + "/manifest");
+  EXPECT_EQ(catalog.size(), 2U);
+
+  upr::catalog_entry entry;
+  ASSERT_TRUE(catalog.find("resnet", &entry));
+  ASSERT_EQ(entry.input_shape.size(), 4U);
+  EXPECT_EQ(entry.input_shape[2], 299);
+  EXPECT_EQ(entry.checksum, "abc");
+
+  ASSERT_TRUE(catalog.find("squeezenet_1.1", &entry));
+  EXPECT_EQ(entry.params_path, squeezenet_dir + "/model.params");
+
+  write_file(base + "/bad_manifest", "missing," + base + "/missing\n");
+  EXPECT_THROW(catalog.load_manifest(base + "/bad_manifest"), std::runtime_error);
+}
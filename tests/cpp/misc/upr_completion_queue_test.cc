@@ -0,0 +1,140 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_completion_queue_test.cc
+ * \brief tests for the completion queue of the asynchronous forwards
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "c_api/upr_completion_queue.h"
+
+namespace {
+
+// the state MXPredForwardAsync, MXPredForward and MXPredGetOutput share, with
+// the forward writing its generation as the output
+struct fake_predictor {
+  upr::pending_forward async_forward;
+  std::atomic<bool> host_outputs_ready{false};
+  int out{0};
+  int host_out{0};
+
+  void forward_async(upr::completion_queue *queue, int generation, std::shared_future<void> copied) {
+    async_forward.join();
+    host_outputs_ready = false;
+    out                = generation;
+    async_forward.post(queue, [this, generation, copied]() {
+      copied.wait();
+      host_out           = generation;
+      host_outputs_ready = true;
+    });
+  }
+
+  void forward(int generation) {
+    async_forward.join();
+    host_outputs_ready = false;
+    out                = generation;
+  }
+
+  int get_output() {
+    async_forward.join();
+    return host_outputs_ready ? host_out : out;
+  }
+};
+
+} // namespace
+
+TEST(CompletionQueue, RunsInOrderOnOneThread) {
+  upr::completion_queue queue;
+  std::mutex mutex;
+  std::vector<int> order;
+  std::vector<std::thread::id> threads;
+  std::vector<std::future<void>> done;
+  for (int ii = 0; ii < 16; ii++) {
+    done.emplace_back(queue.post([&, ii]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.emplace_back(ii);
+      threads.emplace_back(std::this_thread::get_id());
+    }));
+  }
+  for (auto &d : done) {
+    d.get();
+  }
+  ASSERT_EQ(order.size(), 16U);
+  for (int ii = 0; ii < 16; ii++) {
+    EXPECT_EQ(order[ii], ii);
+    EXPECT_EQ(threads[ii], threads[0]);
+  }
+  EXPECT_NE(threads[0], std::this_thread::get_id());
+}
+
+TEST(CompletionQueue, StoresErrorsInTheFuture) {
+  upr::completion_queue queue;
+  auto failed = queue.post([]() { throw std::runtime_error("failed"); });
+  auto next   = queue.post([]() {});
+  EXPECT_THROW(failed.get(), std::runtime_error);
+  EXPECT_NO_THROW(next.get());
+}
+
+TEST(CompletionQueue, RunsPendingCompletionsOnDestruction) {
+  std::atomic<int> count{0};
+  {
+    upr::completion_queue queue;
+    for (int ii = 0; ii < 8; ii++) {
+      queue.post([&count]() { count++; });
+    }
+  }
+  EXPECT_EQ(count.load(), 8);
+}
+
+TEST(PendingForward, SyncForwardAfterAsyncForwardIsNotStale) {
+  upr::completion_queue queue;
+  fake_predictor pred;
+  std::promise<void> copied;
+
+  pred.forward_async(&queue, 1, copied.get_future().share());
+  // the copy of the first forward completes while the second one waits for it
+  std::thread copier([&copied]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    copied.set_value();
+  });
+  pred.forward(2);
+  EXPECT_EQ(pred.get_output(), 2);
+  copier.join();
+  EXPECT_EQ(pred.get_output(), 2);
+}
+
+TEST(PendingForward, GetOutputWaitsForTheAsyncForward) {
+  upr::completion_queue queue;
+  fake_predictor pred;
+  std::promise<void> copied;
+  copied.set_value();
+
+  pred.forward(1);
+  pred.forward_async(&queue, 2, copied.get_future().share());
+  EXPECT_EQ(pred.get_output(), 2);
+  EXPECT_TRUE(pred.host_outputs_ready);
+}
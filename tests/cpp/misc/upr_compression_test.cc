@@ -0,0 +1,149 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_compression_test.cc
+ * \brief round trip tests for the compressed cpu tier of uprd
+ */
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "c_api/upr_compression.h"
+
+namespace {
+
+// a conv weight (8 output channels of 3x3x3), its bias and a fc weight whose
+// channels have very different ranges
+struct model {
+  std::vector<float> conv_weight = random(8 * 27, 0.1f);
+  std::vector<float> conv_bias   = random(8, 0.01f);
+  std::vector<float> fc_weight   = scaled_rows(random(4 * 16, 1.0f), 16);
+
+  static std::vector<float> random(size_t count, float stddev) {
+    static std::mt19937 rng(42);
+    std::normal_distribution<float> dist(0, stddev);
+    std::vector<float> res(count);
+    for (auto &value : res) {
+      value = dist(rng);
+    }
+    return res;
+  }
+
+  static std::vector<float> scaled_rows(std::vector<float> values, size_t row_size) {
+    for (size_t ii = 0; ii < values.size(); ii++) {
+      values[ii] *= std::pow(10.0f, static_cast<float>(ii / row_size) - 2);
+    }
+    return values;
+  }
+
+  upr::compressed_model compress(upr::compression_type type) const {
+    upr::compressed_model res(type);
+    res.add(conv_weight.data(), conv_weight.size(), 8);
+    res.add(conv_bias.data(), conv_bias.size(), 0);
+    res.add(fc_weight.data(), fc_weight.size(), 4);
+    return res;
+  }
+
+  std::vector<float> packed() const {
+    std::vector<float> res(conv_weight);
+    res.insert(res.end(), conv_bias.begin(), conv_bias.end());
+    res.insert(res.end(), fc_weight.begin(), fc_weight.end());
+    return res;
+  }
+};
+
+std::vector<float> decompress(const upr::compressed_model &compressed) {
+  std::vector<float> res(compressed.decompressed_byte_count() / sizeof(float));
+  compressed.decompress(0, compressed.decompressed_byte_count(), reinterpret_cast<char *>(res.data()));
+  return res;
+}
+
+}  // namespace
+
+TEST(UprCompression, HalfConversionRoundTrips) {
+  for (uint32_t half = 0; half < 0x7c00; half++) {
+    EXPECT_EQ(upr::float_to_half(upr::half_to_float(half)), half);
+  }
+  EXPECT_EQ(upr::float_to_half(1e6f), 0x7c00);
+  EXPECT_EQ(upr::float_to_half(-0.0f), 0x8000);
+}
+
+TEST(UprCompression, Fp16IsAccurate) {
+  const model m;
+  const auto compressed = m.compress(upr::compression_type::fp16);
+  EXPECT_EQ(compressed.byte_count(), m.packed().size() * sizeof(uint16_t));
+
+  const auto expected = m.packed();
+  const auto actual   = decompress(compressed);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t ii = 0; ii < expected.size(); ii++) {
+    // half floats have 11 significant bits
+    EXPECT_NEAR(actual[ii], expected[ii], std::fabs(expected[ii]) / 2048 + 6e-8);
+  }
+}
+
+TEST(UprCompression, Int8IsAccuratePerChannel) {
+  const model m;
+  const auto compressed = m.compress(upr::compression_type::int8);
+  EXPECT_EQ(compressed.byte_count(),
+            m.conv_weight.size() + 8 * sizeof(float) + m.conv_bias.size() * sizeof(float) + m.fc_weight.size() +
+                4 * sizeof(float));
+
+  const auto actual = decompress(compressed);
+  // every channel is within half a quantization step of its own range
+  const auto check_channels = [&](const std::vector<float> &expected, size_t offset, size_t num_channels) {
+    const size_t channel_size = expected.size() / num_channels;
+    for (size_t cc = 0; cc < num_channels; cc++) {
+      float max_abs = 0;
+      for (size_t ii = 0; ii < channel_size; ii++) {
+        max_abs = std::max(max_abs, std::fabs(expected[cc * channel_size + ii]));
+      }
+      for (size_t ii = 0; ii < channel_size; ii++) {
+        const auto index = cc * channel_size + ii;
+        EXPECT_NEAR(actual[offset + index], expected[index], max_abs / 127 / 2 * 1.0001f);
+      }
+    }
+  };
+  check_channels(m.conv_weight, 0, 8);
+  check_channels(m.fc_weight, m.conv_weight.size() + m.conv_bias.size(), 4);
+  // the bias is not quantized
+  for (size_t ii = 0; ii < m.conv_bias.size(); ii++) {
+    EXPECT_EQ(actual[m.conv_weight.size() + ii], m.conv_bias[ii]);
+  }
+}
+
+TEST(UprCompression, DecompressesArbitraryChunks) {
+  const model m;
+  for (const auto type : {upr::compression_type::fp16, upr::compression_type::int8}) {
+    const auto compressed = m.compress(type);
+    const auto full       = decompress(compressed);
+    const size_t total    = compressed.decompressed_byte_count();
+    for (const size_t chunk : {4, 12, 100, 1024}) {
+      std::vector<float> chunked(full.size());
+      for (size_t begin = 0; begin < total; begin += chunk) {
+        compressed.decompress(begin, std::min(chunk, total - begin), reinterpret_cast<char *>(chunked.data()) + begin);
+      }
+      EXPECT_EQ(chunked, full);
+    }
+    EXPECT_THROW(compressed.decompress(2, 4, reinterpret_cast<char *>(std::vector<float>(2).data())),
+                 std::runtime_error);
+  }
+}
@@ -0,0 +1,134 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_eviction_test.cc
+ * \brief tests for the uprd eviction indexes
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include "c_api/upr_eviction.h"
+
+TEST(UprEviction, LRUSkipsPinnedModels) {
+  auto index = upr::make_eviction_index("lru");
+  index->insert("a", 10);
+  index->insert("b", 10);
+  index->insert("c", 10);
+
+  index->acquire("a");
+  std::string victim;
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "b");
+
+  index->acquire("b");
+  index->acquire("c");
+  EXPECT_FALSE(index->victim(&victim));
+
+  // "c" is released first, so it is the least recently used
+  index->release("c");
+  index->release("a");
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "c");
+
+  index->erase("c");
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "a");
+}
+
+TEST(UprEviction, FIFOKeepsResidencyOrder) {
+  auto index = upr::make_eviction_index("fifo");
+  index->insert("a", 10);
+  index->insert("b", 10);
+
+  index->acquire("a");
+  index->release("a");
+
+  std::string victim;
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "a");
+
+  index->acquire("a");
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "b");
+}
+
+TEST(UprEviction, LCUPrefersLeastOpened) {
+  auto index = upr::make_eviction_index("lcu");
+  index->insert("a", 10);
+  index->insert("b", 10);
+
+  for (int ii = 0; ii < 3; ii++) {
+    index->acquire("a");
+    index->release("a");
+  }
+  index->acquire("b");
+  index->release("b");
+
+  std::string victim;
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "b");
+  EXPECT_EQ(index->find("a")->frequency, 3U);
+
+  index->erase("b");
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "a");
+}
+
+TEST(UprEviction, NeverHasNoVictims) {
+  auto index = upr::make_eviction_index("never");
+  index->insert("a", 10);
+  std::string victim;
+  EXPECT_FALSE(index->victim(&victim));
+  EXPECT_THROW(upr::make_eviction_index("random"), std::runtime_error);
+}
+
+TEST(UprEviction, GDSFKeepsExpensiveModels) {
+  auto index = upr::make_eviction_index("gdsf");
+  // same size, "a" is ten times more expensive to reload
+  index->insert("a", 100, /*cost=*/1000);
+  index->insert("b", 100, /*cost=*/100);
+  // same cost, "c" is ten times larger
+  index->insert("c", 1000, /*cost=*/100);
+
+  std::string victim;
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "c");
+  index->erase("c");
+
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "b");
+
+  // frequently used models are kept even when cheap
+  for (int ii = 0; ii < 20; ii++) {
+    index->acquire("b");
+    index->release("b");
+  }
+  ASSERT_TRUE(index->victim(&victim));
+  EXPECT_EQ(victim, "a");
+}
+
+TEST(UprEviction, CPUTierRejectsDevicePolicies) {
+  for (const auto policy : {"never", "lru", "fifo", "lcu"}) {
+    EXPECT_NE(upr::make_cpu_eviction_index(policy), nullptr);
+  }
+  for (const auto policy : {"gdsf", "eager", "flush", "all", "random"}) {
+    EXPECT_THROW(upr::make_cpu_eviction_index(policy), std::runtime_error);
+  }
+}
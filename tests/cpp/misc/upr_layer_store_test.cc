@@ -0,0 +1,108 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_layer_store_test.cc
+ * \brief tests for the content addressed layer store of uprd
+ */
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <vector>
+#include "c_api/upr_layer_store.h"
+
+namespace {
+
+// allocates host copies of the weights and counts the live allocations
+class fake_device {
+ public:
+  upr::layer_store::allocate_fn allocate(const std::vector<float> &weights) {
+    return [this, &weights]() {
+      live_++;
+      auto ptr = malloc(weights.size() * sizeof(float));
+      memcpy(ptr, weights.data(), weights.size() * sizeof(float));
+      return ptr;
+    };
+  }
+
+  upr::layer_store::free_fn free() {
+    return [this](void *ptr) {
+      live_--;
+      ::free(ptr);
+    };
+  }
+
+  int live() const {
+    return live_;
+  }
+
+ private:
+  int live_{0};
+};
+
+upr::layer_digest digest(const std::vector<float> &weights) {
+  return upr::digest_layer(weights.data(), weights.size() * sizeof(float));
+}
+
+}  // namespace
+
+TEST(UprLayerStore, DigestsDependOnContent) {
+  const std::vector<float> a{1, 2, 3, 4, 5};
+  const std::vector<float> b{1, 2, 3, 4, 6};
+  EXPECT_EQ(digest(a).str(), digest(std::vector<float>(a)).str());
+  EXPECT_NE(digest(a).str(), digest(b).str());
+  // the same bytes with a different length
+  EXPECT_NE(upr::digest_layer(a.data(), 16).str(), upr::digest_layer(a.data(), 20).str());
+}
+
+TEST(UprLayerStore, SharesIdenticalLayers) {
+  const std::vector<float> backbone{1, 2, 3, 4};
+  const std::vector<float> head_a{5, 6};
+  const std::vector<float> head_b{7, 8};
+  fake_device device;
+  upr::layer_store store;
+
+  bool hit = true;
+  auto backbone_a = store.acquire(digest(backbone), device.allocate(backbone), device.free(), &hit);
+  EXPECT_FALSE(hit);
+  auto ptr_a = store.acquire(digest(head_a), device.allocate(head_a), device.free(), &hit);
+  EXPECT_FALSE(hit);
+
+  // a sibling model with the same backbone
+  auto backbone_b = store.acquire(digest(backbone), device.allocate(backbone), device.free(), &hit);
+  EXPECT_TRUE(hit);
+  EXPECT_EQ(backbone_a, backbone_b);
+  auto ptr_b = store.acquire(digest(head_b), device.allocate(head_b), device.free(), &hit);
+  EXPECT_FALSE(hit);
+
+  EXPECT_EQ(store.size(), 3U);
+  EXPECT_EQ(store.byte_count(), 8 * sizeof(float));
+  EXPECT_EQ(device.live(), 3);
+
+  // evicting the first model only frees its head
+  EXPECT_EQ(store.release(backbone_a, device.free()), 0U);
+  EXPECT_EQ(store.release(ptr_a, device.free()), 2 * sizeof(float));
+  EXPECT_EQ(device.live(), 2);
+
+  EXPECT_EQ(store.release(backbone_b, device.free()), 4 * sizeof(float));
+  EXPECT_EQ(store.release(ptr_b, device.free()), 2 * sizeof(float));
+  EXPECT_EQ(device.live(), 0);
+  EXPECT_EQ(store.size(), 0U);
+  EXPECT_FALSE(store.contains(backbone_a));
+}
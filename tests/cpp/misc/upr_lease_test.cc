@@ -0,0 +1,90 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_lease_test.cc
+ * \brief tests for the leases of the handles opened in uprd
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "c_api/upr_lease.h"
+
+TEST(UprLease, ExpireWithoutHeartbeat) {
+  using std::chrono::milliseconds;
+  upr::lease_table leases(milliseconds(100));
+  const auto t0 = upr::lease_table::clock::now();
+
+  leases.add({"a", "m1", "m1#0"}, t0);
+  leases.add({"a", "m2", "m2#0"}, t0);
+  leases.add({"b", "m1", "m1#1"}, t0);
+  EXPECT_EQ(leases.size(), 2u);
+  EXPECT_EQ(leases.num_handles(), 3u);
+
+  // a renews its lease, b does not
+  EXPECT_TRUE(leases.renew("a", t0 + milliseconds(80)));
+  EXPECT_TRUE(leases.expire(t0 + milliseconds(99)).empty());
+
+  const auto expired = leases.expire(t0 + milliseconds(100));
+  ASSERT_EQ(expired.size(), 1u);
+  EXPECT_EQ(expired[0].client_id, "b");
+  EXPECT_EQ(expired[0].model_id, "m1");
+  EXPECT_EQ(expired[0].handle_id, "m1#1");
+  EXPECT_FALSE(leases.renew("b", t0 + milliseconds(100)));
+  EXPECT_FALSE(leases.remove("m1#1"));
+
+  EXPECT_EQ(leases.expire(t0 + milliseconds(180)).size(), 2u);
+  EXPECT_EQ(leases.size(), 0u);
+  EXPECT_EQ(leases.num_handles(), 0u);
+}
+
+TEST(UprLease, CloseDropsTheLease) {
+  upr::lease_table leases(std::chrono::milliseconds(100));
+  const auto t0 = upr::lease_table::clock::now();
+
+  leases.add({"a", "m1", "m1#0"}, t0);
+  leases.add({"a", "m2", "m2#0"}, t0);
+  EXPECT_TRUE(leases.remove("m1#0"));
+  EXPECT_FALSE(leases.remove("m1#0"));
+  EXPECT_TRUE(leases.renew("a", t0));
+
+  EXPECT_TRUE(leases.remove("m2#0"));
+  EXPECT_FALSE(leases.renew("a", t0));
+  EXPECT_TRUE(leases.expire(t0 + std::chrono::seconds(1)).empty());
+}
+
+TEST(UprLease, ReaperReclaimsExpiredHandles) {
+  upr::lease_table leases(std::chrono::milliseconds(4));
+  std::atomic<size_t> reclaimed{0};
+  {
+    upr::lease_reaper reaper(&leases, [&reclaimed](const std::vector<upr::leased_handle> &handles) {
+      reclaimed += handles.size();
+    });
+    leases.add({"a", "m1", "m1#0"});
+    leases.add({"a", "m1", "m1#1"});
+    for (int ii = 0; ii < 1000 && reclaimed != 2; ii++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  EXPECT_EQ(reclaimed, 2u);
+  EXPECT_EQ(leases.num_handles(), 0u);
+}
@@ -0,0 +1,103 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_metrics_test.cc
+ * \brief tests for the uprd counters, latency histograms and exporters
+ */
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "c_api/upr_metrics.h"
+
+TEST(UprMetrics, BucketsCoverEveryValue) {
+  using h = upr::latency_histogram;
+  const size_t num_buckets = h::num_buckets;
+  const std::vector<uint64_t> values{0, 1, 7, 8, 9, 15, 16, 17, 1000, 123456789, ~uint64_t{0}};
+  for (const auto value : values) {
+    const auto index = h::bucket_index(value);
+    ASSERT_LT(index, num_buckets);
+    EXPECT_GE(h::bucket_upper_bound(index), value);
+    if (index != 0) {
+      EXPECT_LT(h::bucket_upper_bound(index - 1), value);
+    }
+  }
+  EXPECT_EQ(h::bucket_index(~uint64_t{0}), num_buckets - 1);
+}
+
+TEST(UprMetrics, Percentiles) {
+  upr::latency_histogram histogram;
+  EXPECT_EQ(histogram.percentile(0.5), 0u);
+
+  for (uint64_t ii = 1; ii <= 1000; ii++) {
+    histogram.record(ii);
+  }
+  EXPECT_EQ(histogram.count(), 1000u);
+  EXPECT_EQ(histogram.sum(), 500500u);
+  EXPECT_EQ(histogram.max(), 1000u);
+
+  const auto within = [](uint64_t value, uint64_t expected) {
+    return value >= expected && value <= expected + expected / 8;
+  };
+  EXPECT_TRUE(within(histogram.percentile(0.5), 500)) << histogram.percentile(0.5);
+  EXPECT_TRUE(within(histogram.percentile(0.99), 990)) << histogram.percentile(0.99);
+  EXPECT_EQ(histogram.percentile(1), 1000u);
+}
+
+TEST(UprMetrics, PrometheusText) {
+  upr::metrics_registry metrics;
+  auto &opens   = metrics.add_counter("uprd_opens_total", "opens");
+  auto &latency = metrics.add_histogram("uprd_open_latency_microseconds", "open latency");
+  opens.add(3);
+  latency.record(2);
+  latency.record(5);
+
+  upr::prometheus_writer writer;
+  metrics.write(&writer);
+  writer.gauge("uprd_model_bytes", "bytes", 10, {{"model", "a\"b"}, {"tier", "gpu"}});
+  writer.gauge("uprd_model_bytes", "bytes", 20, {{"model", "c"}, {"tier", "cpu"}});
+
+  const auto text = writer.str();
+  EXPECT_NE(text.find("# TYPE uprd_opens_total counter\nuprd_opens_total 3\n"), std::string::npos);
+  EXPECT_NE(text.find("uprd_open_latency_microseconds_bucket{le=\"1\"} 0\n"), std::string::npos);
+  EXPECT_NE(text.find("uprd_open_latency_microseconds_bucket{le=\"3\"} 1\n"), std::string::npos);
+  EXPECT_NE(text.find("uprd_open_latency_microseconds_bucket{le=\"+Inf\"} 2\n"), std::string::npos);
+  EXPECT_NE(text.find("uprd_open_latency_microseconds_sum 7\n"), std::string::npos);
+  EXPECT_NE(text.find("uprd_model_bytes{model=\"a\\\"b\",tier=\"gpu\"} 10\n"), std::string::npos);
+  // the metric is declared once
+  EXPECT_EQ(text.find("# TYPE uprd_model_bytes"), text.rfind("# TYPE uprd_model_bytes"));
+}
+
+TEST(UprMetrics, FileExporter) {
+  const std::string path = "upr_metrics_test.prom";
+  std::remove(path.c_str());
+  {
+    upr::metrics_file_exporter exporter(path, std::chrono::milliseconds(1), []() { return std::string("up 1\n"); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  std::ifstream in(path);
+  std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  EXPECT_EQ(text, "up 1\n");
+  std::remove(path.c_str());
+}
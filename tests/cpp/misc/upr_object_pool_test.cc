@@ -0,0 +1,81 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_object_pool_test.cc
+ * \brief tests for the pool behind the predictor pool
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "c_api/upr_object_pool.h"
+
+TEST(UprObjectPool, AcquireAndRelease) {
+  upr::object_pool<int> pool;
+  EXPECT_THROW(pool.acquire(), std::runtime_error);
+
+  int a = 0, b = 1;
+  pool.add(&a);
+  pool.add(&b);
+  EXPECT_EQ(pool.size(), 2u);
+
+  auto first  = pool.acquire();
+  auto second = pool.acquire();
+  EXPECT_NE(first, second);
+  EXPECT_EQ(pool.available(), 0u);
+  EXPECT_EQ(pool.try_acquire(), nullptr);
+
+  pool.release(first);
+  EXPECT_THROW(pool.release(first), std::runtime_error);
+  int c = 2;
+  EXPECT_THROW(pool.release(&c), std::runtime_error);
+  pool.release(second);
+  EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(UprObjectPool, NeverHandsOutAnObjectTwice) {
+  upr::object_pool<std::atomic<int>> pool;
+  std::vector<std::atomic<int>> objects(3);
+  for (auto &obj : objects) {
+    obj = 0;
+    pool.add(&obj);
+  }
+
+  std::atomic<bool> shared{false};
+  std::vector<std::thread> workers;
+  for (int ii = 0; ii < 8; ii++) {
+    workers.emplace_back([&]() {
+      for (int jj = 0; jj < 1000; jj++) {
+        auto obj = pool.acquire();
+        if ((*obj)++ != 0) {
+          shared = true;
+        }
+        (*obj)--;
+        pool.release(obj);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  EXPECT_FALSE(shared);
+  EXPECT_EQ(pool.available(), 3u);
+}
@@ -0,0 +1,105 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_packed_model_test.cc
+ * \brief tests for the packed model format
+ */
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "c_api/upr_params_mmap.h"
+
+namespace {
+
+std::string temp_path() {
+  char path[] = "/tmp/upr_packed_XXXXXX";
+  close(mkstemp(path));
+  return path;
+}
+
+}  // namespace
+
+TEST(UprPackedModel, RoundTripsAlignedLayers) {
+  const std::vector<float> weight{0, 1, 2, 3, 4, 5};
+  const std::vector<float> bias{6, 7, 8};
+  const std::vector<upr::packed_layer_source> layers{
+      {"arg:fc_weight", 0, {2, 3}, weight.data(), weight.size() * sizeof(float)},
+      {"arg:fc_bias", 0, {3}, bias.data(), bias.size() * sizeof(float)}};
+
+  const auto path = temp_path();
+  upr::write_packed_model(path, layers, "{\"nodes\": []}", /*alignment=*/4096, /*layer_alignment=*/256);
+  EXPECT_TRUE(upr::is_packed_model_file(path));
+
+  upr::mapped_params_file packed(path);
+  EXPECT_TRUE(packed.is_packed());
+  EXPECT_EQ(packed.symbol_json(), "{\"nodes\": []}");
+  const auto &arrays = packed.arrays();
+  ASSERT_EQ(arrays.size(), 2U);
+  EXPECT_EQ(arrays[0].name, "arg:fc_weight");
+  EXPECT_EQ(arrays[0].shape, (std::vector<int64_t>{2, 3}));
+  EXPECT_EQ(arrays[0].offset % 4096, 0U);
+  EXPECT_EQ(arrays[1].offset - arrays[0].offset, 256U);
+  EXPECT_EQ(reinterpret_cast<const float *>(arrays[1].data)[2], 8);
+  for (const auto &array : arrays) {
+    EXPECT_EQ(upr::packed_checksum(array.data, array.byte_count), array.checksum);
+  }
+}
+
+TEST(UprPackedModel, RejectsCorruptIndex) {
+  const std::vector<float> weight{0, 1, 2, 3};
+  const auto path = temp_path();
+  upr::write_packed_model(path, {{"w", 0, {2, 2}, weight.data(), weight.size() * sizeof(float)}}, "");
+
+  // the shape no longer matches the byte count
+  {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    const int64_t dim = 3;
+    file.seekp(10 * sizeof(uint64_t) + sizeof(uint64_t) + 1 + sizeof(int32_t) + sizeof(uint32_t));
+    file.write(reinterpret_cast<const char *>(&dim), sizeof(dim));
+  }
+  EXPECT_THROW(upr::mapped_params_file packed(path), std::runtime_error);
+
+  // the data region is cut off
+  upr::write_packed_model(path, {{"w", 0, {2, 2}, weight.data(), weight.size() * sizeof(float)}}, "");
+  EXPECT_EQ(truncate(path.c_str(), 4096), 0);
+  EXPECT_THROW(upr::mapped_params_file packed(path), std::runtime_error);
+}
+
+TEST(UprPackedModel, DetectsCorruptData) {
+  const std::vector<float> weight{0, 1, 2, 3};
+  const auto path = temp_path();
+  upr::write_packed_model(path, {{"w", 0, {2, 2}, weight.data(), weight.size() * sizeof(float)}}, "");
+  {
+    upr::mapped_params_file packed(path);
+    EXPECT_NO_THROW(upr::verify_packed_arrays(packed.arrays()));
+  }
+
+  // flips a byte of the weights, which the index does not cover
+  {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(4096 + 5);
+    file.put(0x7f);
+  }
+  upr::mapped_params_file packed(path);
+  EXPECT_THROW(upr::verify_packed_arrays(packed.arrays()), std::runtime_error);
+}
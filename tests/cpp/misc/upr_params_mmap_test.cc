@@ -0,0 +1,116 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_params_mmap_test.cc
+ * \brief tests for the memory mapped params file parser
+ */
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "c_api/upr_params_mmap.h"
+
+namespace {
+
+// writes a list of float32 arrays in the format of NDArray::Save
+class params_writer {
+ public:
+  explicit params_writer(const std::string &path) : out_(path, std::ios::binary) {
+    write<uint64_t>(0x112);
+    write<uint64_t>(0);
+  }
+
+  void begin_arrays(uint64_t count) {
+    write<uint64_t>(count);
+  }
+
+  void array(const std::vector<int64_t> &shape, const std::vector<float> &data) {
+    write<uint32_t>(0xF993fac9);
+    write<int32_t>(0);  // dense storage
+    write<uint32_t>(shape.size());
+    for (const auto dim : shape) {
+      write<int64_t>(dim);
+    }
+    write<int32_t>(1);  // gpu context
+    write<int32_t>(0);
+    write<int32_t>(0);  // float32
+    out_.write(reinterpret_cast<const char *>(data.data()), data.size() * sizeof(float));
+  }
+
+  void names(const std::vector<std::string> &names) {
+    write<uint64_t>(names.size());
+    for (const auto &name : names) {
+      write<uint64_t>(name.size());
+      out_.write(name.data(), name.size());
+    }
+  }
+
+ private:
+  template <typename T>
+  void write(T value) {
+    out_.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  std::ofstream out_;
+};
+
+std::string temp_path() {
+  char path[] = "/tmp/upr_params_XXXXXX";
+  close(mkstemp(path));
+  return path;
+}
+
+}  // namespace
+
+TEST(UprParamsMmap, ParsesArraysInPlace) {
+  const auto path = temp_path();
+  {
+    params_writer writer(path);
+    writer.begin_arrays(2);
+    writer.array({2, 3}, {0, 1, 2, 3, 4, 5});
+    writer.array({4}, {6, 7, 8, 9});
+    writer.names({"arg:fc_weight", "aux:bn_moving_mean"});
+  }
+
+  upr::mapped_params_file params(path);
+  const auto &arrays = params.arrays();
+  ASSERT_EQ(arrays.size(), 2U);
+  EXPECT_EQ(arrays[0].name, "arg:fc_weight");
+  EXPECT_EQ(arrays[0].shape, (std::vector<int64_t>{2, 3}));
+  EXPECT_EQ(arrays[0].byte_count, 6 * sizeof(float));
+  EXPECT_EQ(arrays[1].name, "aux:bn_moving_mean");
+  EXPECT_EQ(reinterpret_cast<const float *>(arrays[1].data)[3], 9);
+  EXPECT_EQ(params.byte_count(), 10 * sizeof(float));
+}
+
+TEST(UprParamsMmap, RejectsTruncatedFiles) {
+  const auto path = temp_path();
+  {
+    params_writer writer(path);
+    writer.begin_arrays(2);
+    writer.array({2, 3}, {0, 1, 2, 3, 4, 5});
+  }
+  EXPECT_THROW(upr::mapped_params_file params(path), std::runtime_error);
+
+  std::ofstream(path) << "not a params file";
+  EXPECT_THROW(upr::mapped_params_file params(path), std::runtime_error);
+}
@@ -0,0 +1,113 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_template_cache_test.cc
+ * \brief tests for the predictor template cache
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "c_api/upr_template_cache.h"
+
+namespace {
+
+struct fake_template {
+  std::string symbol;
+};
+
+std::shared_ptr<const fake_template> build(const std::string &symbol, int *num_builds) {
+  (*num_builds)++;
+  return std::make_shared<fake_template>(fake_template{symbol});
+}
+
+std::string key(const std::string &symbol, uint32_t batch_size, int dev_id = 0) {
+  const std::vector<uint32_t> indptr{0, 4};
+  const std::vector<uint32_t> shape{batch_size, 3, 224, 224};
+  return upr::to_template_key(symbol, {}, {"data"}, indptr.data(), shape.data(), 2, dev_id);
+}
+
+}  // namespace
+
+TEST(UprTemplateCache, KeyDependsOnSymbolShapesAndContext) {
+  EXPECT_EQ(key("{\"nodes\": []}", 1), key("{\"nodes\": []}", 1));
+  EXPECT_NE(key("{\"nodes\": []}", 1), key("{\"nodes\": [1]}", 1));
+  EXPECT_NE(key("{\"nodes\": []}", 1), key("{\"nodes\": []}", 8));
+  EXPECT_NE(key("{\"nodes\": []}", 1), key("{\"nodes\": []}", 1, 1));
+
+  const std::vector<uint32_t> indptr{0, 1};
+  const std::vector<uint32_t> shape{1};
+  EXPECT_NE(upr::to_template_key("s", {"fc1"}, {"data"}, indptr.data(), shape.data(), 1, 0),
+            upr::to_template_key("s", {"fc2"}, {"data"}, indptr.data(), shape.data(), 1, 0));
+}
+
+TEST(UprTemplateCache, BuildsOncePerKey) {
+  upr::template_cache<fake_template> cache(2);
+  int num_builds = 0;
+  bool hit       = true;
+
+  EXPECT_EQ(cache.find("a"), nullptr);
+  const auto first = cache.get_or_build("a", [&]() { return build("a", &num_builds); }, &hit);
+  EXPECT_FALSE(hit);
+  const auto second = cache.get_or_build("a", [&]() { return build("a", &num_builds); }, &hit);
+  EXPECT_TRUE(hit);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(cache.find("a"), first);
+  EXPECT_EQ(num_builds, 1);
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(cache.misses(), 1u);
+
+  // a failed build is not cached
+  EXPECT_THROW(cache.get_or_build("b", []() -> std::shared_ptr<const fake_template> {
+    throw std::runtime_error("invalid symbol");
+  }),
+               std::runtime_error);
+  EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(UprTemplateCache, EvictsLeastRecentlyUsed) {
+  upr::template_cache<fake_template> cache(2);
+  int num_builds = 0;
+  const auto get = [&](const std::string &k) { return cache.get_or_build(k, [&]() { return build(k, &num_builds); }); };
+
+  const auto a = get("a");
+  get("b");
+  get("a");
+  get("c"); // evicts b
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(num_builds, 3);
+  get("a");
+  EXPECT_EQ(num_builds, 3);
+  get("b");
+  EXPECT_EQ(num_builds, 4);
+
+  // evicted templates stay alive while in use
+  cache.clear();
+  EXPECT_EQ(a->symbol, "a");
+}
+
+TEST(UprTemplateCache, ZeroCapacityDisablesTheCache) {
+  upr::template_cache<fake_template> cache(0);
+  int num_builds = 0;
+  cache.get_or_build("a", [&]() { return build("a", &num_builds); });
+  cache.get_or_build("a", [&]() { return build("a", &num_builds); });
+  EXPECT_EQ(num_builds, 2);
+  EXPECT_EQ(cache.size(), 0u);
+}
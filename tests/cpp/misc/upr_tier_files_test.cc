@@ -0,0 +1,124 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * Copyright (c) 2018 by Contributors
+ * \file upr_tier_files_test.cc
+ * \brief tests for the file backed segments of the uprd cpu tier
+ */
+#include <gtest/gtest.h>
+#include <dirent.h>
+#include <stdlib.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "c_api/upr_tier_files.h"
+
+namespace {
+
+std::string make_temp_directory() {
+  char path[] = "/tmp/upr_tier_files_testXXXXXX";
+  return mkdtemp(path);
+}
+
+size_t count_files(const std::string &directory) {
+  size_t res = 0;
+  DIR *dir   = opendir(directory.c_str());
+  while (auto entry = readdir(dir)) {
+    res += entry->d_name[0] != '.';
+  }
+  closedir(dir);
+  return res;
+}
+
+void remove_directory(const std::string &directory) {
+  DIR *dir = opendir(directory.c_str());
+  while (auto entry = readdir(dir)) {
+    if (entry->d_name[0] != '.') {
+      unlink((directory + "/" + entry->d_name).c_str());
+    }
+  }
+  closedir(dir);
+  rmdir(directory.c_str());
+}
+
+upr::tier_file_index make_index(const std::string &model_name) {
+  upr::tier_file_index index;
+  index.model_name     = model_name;
+  index.source_version = "123:456";
+  index.byte_count     = 6 * sizeof(float);
+  index.layers.push_back({"conv 0_weight", {2, 2}, 0, 4 * sizeof(float)});
+  index.layers.push_back({"conv0_bias", {2}, 4 * sizeof(float), 2 * sizeof(float)});
+  return index;
+}
+
+}  // namespace
+
+TEST(UprTierFiles, IndexRoundTrip) {
+  const auto index  = make_index("resnet/50 v1");
+  const auto parsed = upr::parse_tier_file_index(upr::to_tier_file_index_text(index));
+  EXPECT_EQ(parsed.model_name, index.model_name);
+  EXPECT_EQ(parsed.source_version, index.source_version);
+  EXPECT_EQ(parsed.byte_count, index.byte_count);
+  ASSERT_EQ(parsed.layers.size(), 2u);
+  EXPECT_EQ(parsed.layers[0].name, "conv 0_weight");
+  EXPECT_EQ(parsed.layers[0].shape, (std::vector<int64_t>{2, 2}));
+  EXPECT_EQ(parsed.layers[1].offset, 4 * sizeof(float));
+
+  auto text = upr::to_tier_file_index_text(index);
+  EXPECT_THROW(upr::parse_tier_file_index(text.substr(0, text.size() - 12)), std::runtime_error);
+  auto out_of_bounds = index;
+  out_of_bounds.layers[1].byte_count *= 2;
+  EXPECT_THROW(upr::parse_tier_file_index(upr::to_tier_file_index_text(out_of_bounds)), std::runtime_error);
+}
+
+TEST(UprTierFiles, RestoreCommittedSegments) {
+  const auto directory = make_temp_directory();
+  const float weights[] = {1, 2, 3, 4, 5, 6};
+  {
+    upr::tier_file_store store(directory);
+    auto committed = store.allocate("resnet/50 v1", sizeof(weights));
+    memcpy(committed, weights, sizeof(weights));
+    store.commit(committed, make_index("resnet/50 v1"));
+
+    // never committed, as if uprd stopped while copying it
+    auto partial = store.allocate("vgg16", sizeof(weights));
+    memset(partial, 0, sizeof(weights));
+
+    auto released = store.allocate("alexnet", sizeof(weights));
+    store.commit(released, make_index("alexnet"));
+    store.release(released);
+    EXPECT_EQ(store.size(), 2u);
+  }
+
+  upr::tier_file_store store(directory);
+  auto restored = store.restore();
+  ASSERT_EQ(restored.size(), 1u);
+  EXPECT_EQ(restored[0].index.model_name, "resnet/50 v1");
+  EXPECT_EQ(memcmp(restored[0].base_ptr, weights, sizeof(weights)), 0);
+  EXPECT_TRUE(store.contains(restored[0].base_ptr));
+  // the data and the index of the committed segment
+  EXPECT_EQ(count_files(directory), 2u);
+  // the mapped segments are not restored twice
+  EXPECT_TRUE(store.restore().empty());
+
+  store.release(restored[0].base_ptr);
+  EXPECT_EQ(count_files(directory), 0u);
+  remove_directory(directory);
+}
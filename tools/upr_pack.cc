@@ -0,0 +1,112 @@
+// Converts a params file written by NDArray::Save into a packed model.
+//
+// A packed model can be memory mapped and used in place by uprd, MXPredCreate
+// and MXNDArrayLoad, since the layer index is stored up front and the data of
+// every layer is aligned. See upr_packed_model.h for the layout.
+//
+// usage: upr_pack [--symbol <symbol_file>] [--alignment <bytes>]
+//                 [--layer-alignment <bytes>] <params_file> <packed_file>
+//        upr_pack --verify <packed_file>
+//
+// --symbol embeds the symbol json in the packed model. --alignment is the
+// alignment of the data region (4096 by default, 2097152 to back the mapping
+// with huge pages) and --layer-alignment the alignment of every layer (256 by
+// default). --verify recomputes the checksums of the layers of a packed model.
+
+#include "fmt/format.h"
+#include "upr_packed_model.h"
+#include "upr_params_mmap.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace upr;
+
+static std::string read_file(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(fmt::format("unable to open {}", path));
+  }
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+static int verify(const std::string &packed_path) {
+  mapped_params_file packed(packed_path);
+  if (!packed.is_packed()) {
+    std::cerr << packed_path << " is not a packed model\n";
+    return 1;
+  }
+  size_t mismatches = 0;
+  for (const auto &array : packed.arrays()) {
+    if (packed_checksum(array.data, array.byte_count) != array.checksum) {
+      std::cerr << fmt::format("checksum mismatch for the layer {}\n", array.name);
+      mismatches++;
+    }
+  }
+  std::cout << fmt::format("verified {} layers of {}. {} mismatches\n", packed.arrays().size(), packed_path,
+                           mismatches);
+  return mismatches == 0 ? 0 : 1;
+}
+
+static void usage(const char *program) {
+  std::cerr << "usage: " << program
+            << " [--symbol <symbol_file>] [--alignment <bytes>] [--layer-alignment <bytes>] <params_file> "
+               "<packed_file>\n"
+            << "       " << program << " --verify <packed_file>\n";
+}
+
+int main(int argc, const char *argv[]) {
+  std::string symbol_path{};
+  size_t alignment       = 4096;
+  size_t layer_alignment = 256;
+  std::vector<std::string> positional{};
+  bool verify_only = false;
+
+  for (int ii = 1; ii < argc; ii++) {
+    const std::string arg(argv[ii]);
+    if (arg == "--verify") {
+      verify_only = true;
+    } else if ((arg == "--symbol" || arg == "--alignment" || arg == "--layer-alignment") && ii + 1 < argc) {
+      const std::string value(argv[++ii]);
+      if (arg == "--symbol") {
+        symbol_path = value;
+      } else if (arg == "--alignment") {
+        alignment = std::stoull(value);
+      } else {
+        layer_alignment = std::stoull(value);
+      }
+    } else {
+      positional.emplace_back(arg);
+    }
+  }
+
+  if (verify_only) {
+    if (positional.size() != 1) {
+      usage(argv[0]);
+      return 1;
+    }
+    return verify(positional[0]);
+  }
+  if (positional.size() != 2) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  mapped_params_file params(positional[0]);
+  std::vector<packed_layer_source> layers{};
+  for (const auto &array : params.arrays()) {
+    layers.emplace_back(packed_layer_source{array.name, array.type_flag, array.shape, array.data, array.byte_count});
+  }
+  const auto symbol_json = symbol_path.empty() ? params.symbol_json() : read_file(symbol_path);
+
+  write_packed_model(positional[1], layers, symbol_json, alignment, layer_alignment);
+
+  std::cout << fmt::format("packed {} layers ({} bytes) of {} into {}\n", layers.size(), params.byte_count(),
+                           positional[0], positional[1]);
+  return 0;
+}
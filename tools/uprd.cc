@@ -1,7 +1,20 @@
 #include "fmt/format.h"
 #include "ipc.h"
+#include "upr_compression.h"
+#include "upr_eviction.h"
+#include "upr_lease.h"
+#include "upr_layer_store.h"
+#include "upr_memory_estimate.h"
+#include "upr_metrics.h"
+#include "upr_packed_ndarray.h"
+#include "upr_params_mmap.h"
+#include "upr_pipelined_copy.h"
+#include "upr_prepared_graph.h"
+#include "upr_tier_files.h"
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <csignal>
 #include <dmlc/base.h>
 #include <dmlc/io.h>
@@ -11,9 +24,15 @@
 #include <dmlc/recordio.h>
 #include <dmlc/type_traits.h>
 #include <fstream>
+#include <functional>
 #include <future>
+#include <mutex>
 #include <nnvm/node.h>
+#include <queue>
 #include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "mxnet/c_api.h"
 #include "mxnet/c_predict_api.h"
@@ -30,6 +49,10 @@
 
 #include <cuda_runtime_api.h>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <hopscotch/hopscotch_map.h>
 #include <hopscotch/hopscotch_sc_map.h>
 
@@ -57,6 +80,68 @@ std::vector<K> keys(const tsl::hopscotch_sc_map<K, V> &m) {
   return res;
 }
 
+// fixed size pool of threads that run the work that must not block the
+// completion queue threads or hold the registry lock: the cold model loads and
+// the demotions of the evicted models
+class worker_pool {
+public:
+  explicit worker_pool(int num_workers) {
+    for (int ii = 0; ii < std::max(num_workers, 1); ii++) {
+      workers_.emplace_back([this]() { work(); });
+    }
+  }
+
+  ~worker_pool() {
+    stop();
+  }
+
+  void submit(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.emplace(std::move(task));
+    }
+    cv_.notify_one();
+  }
+
+  // finishes the pending tasks and joins the workers
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return;
+      }
+      stopped_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+private:
+  void work() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::queue<std::function<void()>> tasks_{};
+  std::vector<std::thread> workers_{};
+  bool stopped_{false};
+};
+
 class RegistryImpl final : public Registry::Service {
 private:
   struct model_info {
@@ -67,42 +152,149 @@ private:
     std::vector<void *> data{};
     std::vector<size_t> offsets{};
     std::vector<std::string> layer_names{};
+    // set if the cpu copy is compressed (UPRD_CPU_COMPRESSION). base_ptr and
+    // data are then unused, and byte_count is the compressed size
+    std::shared_ptr<compressed_model> compressed{nullptr};
+    // the digests of the layers of a layer granularity copy with
+    // UPRD_DEDUP_LAYERS. they are computed from the source of the copy, since
+    // reading the write combined copy from the cpu is slow
+    std::vector<layer_digest> digests{};
   };
   using cpu_persistent_data_t = std::map<std::string, model_info *>;
   using memory_db_t           = tsl::hopscotch_sc_map<std::string, Model *, std::hash<std::string>>;
 
+  // the part of a resident model that is only used to serve Open and Close
+  struct resident_model {
+    std::string model_name{};
+    // the reply to Open. it is built once when the model is loaded, and only
+    // the handle id differs between opens
+    ModelHandle open_reply{};
+    uint64_t next_handle{0};
+    std::unordered_set<uint64_t> open_handles{};
+  };
+
+  // the host tier. copies of the models in pinned memory, which are used to
+  // reload evicted models without reading them from disk. bounded by
+  // UPRD_CPU_MEMORY_LIMIT, and guarded by cpu_persistent_data_mutex_
   cpu_persistent_data_t cpu_persistent_data{};
+  std::unique_ptr<eviction_index> cpu_eviction_index_{make_cpu_eviction_index(UPRD_CPU_EVICTION_POLICY)};
+  size_t cpu_memory_usage_{0};
+  std::mutex cpu_persistent_data_mutex_;
+  // with UPRD_CPU_TIER_DIR, the uncompressed model granularity copies of the
+  // host tier are files of that directory, which outlive uprd and are restored
+  // by restore_cpu_tier on the next start
+  std::unique_ptr<tier_file_store> cpu_tier_files_{
+      UPRD_PERSIST_CPU && !UPRD_CPU_TIER_DIR.empty() ? new tier_file_store(UPRD_CPU_TIER_DIR) : nullptr};
+
+  // the device allocations of the layers of layer granularity models, keyed
+  // by the content of the layers
+  layer_store layer_store_{};
+
+  // the counters and latency histograms served by Stats and written by the
+  // metrics exporter. they are recorded without holding any lock
+  metrics_registry metrics_{};
+  upr::counter &opens_         = metrics_.add_counter("uprd_opens_total", "opens served, including the failed ones");
+  upr::counter &open_hits_     = metrics_.add_counter("uprd_open_hits_total", "opens of resident models");
+  upr::counter &open_misses_   = metrics_.add_counter("uprd_open_misses_total", "opens of cold models");
+  upr::counter &open_failures_ = metrics_.add_counter("uprd_open_failures_total", "opens that returned an error");
+  upr::counter &closes_        = metrics_.add_counter("uprd_closes_total", "closes served");
+  upr::counter &loads_         = metrics_.add_counter("uprd_loads_total", "cold loads");
+  upr::counter &load_failures_ = metrics_.add_counter("uprd_load_failures_total", "cold loads that failed");
+  upr::counter &cpu_tier_loads_ =
+      metrics_.add_counter("uprd_cpu_tier_loads_total", "cold loads served from the cpu tier instead of disk");
+  upr::counter &evictions_     = metrics_.add_counter("uprd_evictions_total", "models evicted from the device");
+  upr::counter &evicted_bytes_ = metrics_.add_counter("uprd_evicted_bytes_total", "bytes freed by the evictions");
+  upr::counter &demotions_     = metrics_.add_counter("uprd_demotions_total", "evicted models copied to the cpu tier");
+  upr::counter &cpu_evictions_ = metrics_.add_counter("uprd_cpu_evictions_total", "models evicted from the cpu tier");
+  upr::counter &reclaimed_handles_ =
+      metrics_.add_counter("uprd_reclaimed_handles_total", "handles closed since the lease of their client expired");
+  upr::counter &restored_models_ =
+      metrics_.add_counter("uprd_restored_models_total", "models restored into the cpu tier from UPRD_CPU_TIER_DIR");
+  latency_histogram &open_latency_  = metrics_.add_histogram("uprd_open_latency_microseconds", "latency of Open");
+  latency_histogram &close_latency_ = metrics_.add_histogram("uprd_close_latency_microseconds", "latency of Close");
+  latency_histogram &load_latency_  = metrics_.add_histogram("uprd_load_latency_microseconds", "duration of a load");
+  latency_histogram &evict_latency_ = metrics_.add_histogram("uprd_evict_latency_microseconds", "duration of an evict");
+  const std::chrono::steady_clock::time_point started_at_{std::chrono::steady_clock::now()};
+
+  static size_t cpu_memory_limit() {
+    static const size_t limit =
+        UPRD_CPU_MEMORY_LIMIT > 0 ? static_cast<size_t>(UPRD_CPU_MEMORY_LIMIT) : host_memory_total() / 2;
+    return limit;
+  }
 
-  void model_delete(Model *ptr) {
+  // frees the memory of the model and returns the number of bytes freed
+  size_t model_delete(Model *ptr) {
     if (ptr == nullptr) {
-      return;
+      return 0;
     }
     auto span =
         start_span("deleting_model", "destroy", span_props{{"model_id", ptr->id()}, {"model_name", ptr->name()}});
 
     LOG(INFO) << "deleting model id=" << ptr->id();
     auto owned = ptr->owned_model();
+    if (owned.memory_backend() == MemoryBackend_CPUShared) {
+      release_shared_memory(owned);
+      stop_span(span);
+      return owned.byte_count();
+    }
     if (owned.sharing_granularity() == SharingGranularity_Layer) {
+      size_t freed = 0;
       for (auto layer : owned.layer()) {
         void *dptr = (void *) layer.device_raw_ptr();
         if (dptr != nullptr) {
-          cudaFree(dptr);
+          freed += free_device_layer(dptr, layer.byte_count());
         }
       }
       stop_span(span);
-      return;
+      return freed;
     }
     if (owned.sharing_granularity() == SharingGranularity_Model) {
-      void *dptr = (void *) owned.device_raw_ptr();
-      if (dptr != nullptr) {
-        cudaFree(dptr);
+      if (owned.device_raw_ptr() != 0) {
+        free_device_model(ptr->name(), owned);
       }
       stop_span(span);
-      return;
+      return owned.byte_count();
     }
     throw std::runtime_error("invalid sharing granularity");
   }
 
+  // demotes an evicted model to the cpu tier and frees its device memory on
+  // demotion_worker_, so that the device to host copy does not hold the
+  // registry lock. loads wait for the memory with wait_for_device_frees
+  void free_device_model(const std::string &model_name, const ModelHandle &owned) {
+    {
+      std::lock_guard<std::mutex> lock(demotions_mutex_);
+      device_frees_pending_++;
+    }
+    demotion_worker_.submit([this, model_name, owned]() {
+      bool freed             = false;
+      const auto free_device = [&]() {
+        if (freed) {
+          return;
+        }
+        freed = true;
+        cudaFree((void *) owned.device_raw_ptr());
+        {
+          std::lock_guard<std::mutex> lock(demotions_mutex_);
+          device_frees_pending_--;
+        }
+        device_memory_freed_.notify_all();
+      };
+      try {
+        demote_to_cpu(model_name, owned, free_device);
+      } catch (const std::exception &error) {
+        LOG(ERROR) << "unable to demote " << model_name << " to the cpu tier. " << error.what();
+      }
+      free_device();
+    });
+  }
+
+  // blocks until the device memory of the evicted models is freed
+  void wait_for_device_frees() {
+    std::unique_lock<std::mutex> lock(demotions_mutex_);
+    device_memory_freed_.wait(lock, [this]() { return device_frees_pending_ == 0; });
+  }
+
   std::string get_ipc_id(const std::string &id, const std::string &layer_name) {
     auto name = layer_name;
 
@@ -160,46 +352,68 @@ private:
     }
   }
 
-  void to_layer_from_disk(Layer *layer, const std::string &name, const NDArray &array, int64_t ref_count,
-                          cudaStream_t stream = 0) {
-    auto span = start_span("to_layer_from_disk", "convert",
-                           span_props{{"ref_count", std::to_string(ref_count)}, {"name", name}});
-
-    // LOG(INFO) << "converting " << name << " ndarray to protobuf
-    // representation with ref_count = " << ref_count;
-    const auto id = sole::uuid4().str();
+  // copies the weights of a layer to the device. with UPRD_DEDUP_LAYERS the
+  // allocation comes from layer_store_, so layers with identical weights (in
+  // this model or in any other resident model) share a single allocation.
+  // shared_bytes is incremented by the size of the layer if it was shared.
+  // the layer is digested unless its digest is given
+  void *to_device_layer(const std::string &name, const void *cpu_ptr, size_t byte_count, cudaStream_t stream,
+                        size_t *shared_bytes, const layer_digest *known_digest = nullptr) {
+    const auto allocate = [&]() -> void * {
+      void *device_ptr;
+      CUDA_CHECK_CALL(cudaMalloc(&device_ptr, byte_count), "cannot allocate layer");
+      CUDA_CHECK_CALL(cudaMemcpyAsync(device_ptr, cpu_ptr, byte_count, cudaMemcpyHostToDevice, stream),
+                      "cannot copy layer");
+      return device_ptr;
+    };
+    if (!UPRD_DEDUP_LAYERS) {
+      return allocate();
+    }
 
-    const auto blob       = array.data();
-    const float *cpu_ptr  = (float *) blob.dptr_;
-    const auto byte_count = blob.Size() * element_size;
+    auto span = start_span("digest_layer", "convert", span_props{{"name", name}});
+    const auto digest = known_digest != nullptr ? *known_digest : digest_layer(cpu_ptr, byte_count);
+    stop_span(span);
 
-    void *device_ptr;
-    CUDA_CHECK_CALL(cudaMalloc(&device_ptr, byte_count), "cannot allocate layer");
-    CUDA_CHECK_CALL(cudaMemcpyAsync(device_ptr, cpu_ptr, byte_count, cudaMemcpyHostToDevice, stream),
-                    "cannot copy layer");
+    bool hit         = false;
+    void *device_ptr = layer_store_.acquire(
+        digest,
+        [&]() {
+          auto ptr = allocate();
+          // other models may use the allocation as soon as it is in the store
+          CUDA_CHECK_CALL(cudaStreamSynchronize(stream), "failed to synchronize stream");
+          return ptr;
+        },
+        [](void *ptr) { cudaFree(ptr); }, &hit);
+    if (hit && shared_bytes != nullptr) {
+      *shared_bytes += byte_count;
+    }
+    return device_ptr;
+  }
 
-    const auto shape = layer->mutable_shape();
-    layer->set_id(id);
-    layer->set_name(name);
+  // frees a layer allocated by to_device_layer and returns the number of
+  // bytes freed, which is 0 if the allocation is still used by another layer
+  size_t free_device_layer(void *device_ptr, size_t byte_count) {
+    if (layer_store_.contains(device_ptr)) {
+      return layer_store_.release(device_ptr, [](void *ptr) { cudaFree(ptr); });
+    }
+    cudaFree(device_ptr);
+    return byte_count;
+  }
 
-    to_shape(shape, array.shape());
+  void to_layer_from_disk(Layer *layer, const std::string &name, const NDArray &array, int64_t ref_count,
+                          cudaStream_t stream = 0, size_t *shared_bytes = nullptr) {
+    auto span = start_span("to_layer_from_disk", "convert",
+                           span_props{{"ref_count", std::to_string(ref_count)}, {"name", name}});
 
-    layer->set_byte_count(byte_count);
-    if (ref_count == -1) { // special value for owned model
-      layer->set_ipc_handle("[owned]");
-    } else {
-      make_ipc_handle(layer, array);
-    }
-    // LOG(INFO) << "setting device_ptr = " << (int64_t) blob.dptr<float>();
-    layer->set_device_raw_ptr((int64_t) blob.dptr<float>());
-    layer->set_sharing_granularity(SharingGranularity_Layer);
-    layer->set_ref_count(ref_count);
+    const auto blob = array.data();
+    to_layer_from_cpu_mem(layer, name, blob.dptr_, array.shape(), ref_count, stream, shared_bytes);
 
     stop_span(span);
   }
 
   void to_layer_from_cpu_mem(Layer *layer, std::string name, const void *ptr, const TShape &tshape, int64_t ref_count,
-                             cudaStream_t stream = 0) {
+                             cudaStream_t stream = 0, size_t *shared_bytes = nullptr,
+                             const layer_digest *digest = nullptr) {
     auto span = start_span("to_layer_from_cpu_mem", "convert",
                            span_props{{"ref_count", std::to_string(ref_count)}, {"name", name}});
 
@@ -210,11 +424,7 @@ private:
     const size_t type_size  = element_size;
     const size_t byte_count = type_size * tshape.Size();
 
-    float *dev_ptr = nullptr;
-
-    CUDA_CHECK_CALL(cudaMalloc(&dev_ptr, byte_count), "failed to allocate device pointer while creating cpu memory");
-    CUDA_CHECK_CALL(cudaMemcpyAsync(dev_ptr, ptr, byte_count, cudaMemcpyHostToDevice, stream),
-                    "faile to copy cpu memory to gpu");
+    void *dev_ptr = to_device_layer(name, ptr, byte_count, stream, shared_bytes, digest);
 
     const auto shape = layer->mutable_shape();
     layer->set_id(id);
@@ -230,13 +440,17 @@ private:
     }
     // LOG(INFO) << "setting device_ptr = " << (int64_t) blob.dptr<float>();
     layer->set_device_raw_ptr((int64_t) dev_ptr);
+    layer->set_sharing_granularity(SharingGranularity_Layer);
     layer->set_ref_count(ref_count);
 
     stop_span(span);
   }
 
+  // the copy is kept in UPRD_CPU_TIER_DIR if model_name is set, which is only
+  // the case for the copies that are persisted in the cpu tier
   model_info *to_model_info_for_model_sharing_granularity(const std::vector<NDArray> &arrays,
-                                                          const std::vector<std::string> &layer_names) {
+                                                          const std::vector<std::string> &layer_names,
+                                                          const std::string &model_name = "") {
     size_t total_byte_count = 0;
     const size_t type_size  = element_size;
 
@@ -246,10 +460,7 @@ private:
       total_byte_count += type_size * blob.Size();
     }
 
-    void *base_ptr = nullptr;
-
-    CUDA_CHECK_CALL(cudaMallocHost(&base_ptr, total_byte_count, cudaHostAllocWriteCombined),
-                    "failed to allocate base_ptr cpu memory");
+    void *base_ptr = allocate_cpu_copy(model_name, total_byte_count);
     CHECK(base_ptr != NULL) << "unable to allocate cpu memory";
 
     size_t ii     = 0;
@@ -277,9 +488,82 @@ private:
       offset += byte_count;
     }
 
+    commit_cpu_copy(model_name, info);
     return info;
   }
 
+  // allocates the pinned memory of a contiguous cpu copy. the memory is a file
+  // of UPRD_CPU_TIER_DIR when the copy belongs to the cpu tier, and falls back
+  // to write combined memory. returns nullptr if the memory cannot be allocated
+  void *allocate_cpu_copy(const std::string &model_name, size_t byte_count) {
+    byte_count = std::max(byte_count, size_t{1});
+    if (cpu_tier_files_ != nullptr && !model_name.empty()) {
+      try {
+        void *ptr = cpu_tier_files_->allocate(model_name, byte_count);
+        if (cudaHostRegister(ptr, byte_count, cudaHostRegisterDefault) == cudaSuccess) {
+          return ptr;
+        }
+        LOG(ERROR) << "unable to pin the cpu tier file of " << model_name;
+        cpu_tier_files_->release(ptr);
+      } catch (const std::runtime_error &error) {
+        LOG(ERROR) << "unable to allocate a cpu tier file for " << model_name << ". " << error.what();
+      }
+    }
+    void *ptr = nullptr;
+    if (cudaMallocHost(&ptr, byte_count, cudaHostAllocWriteCombined) != cudaSuccess) {
+      return nullptr;
+    }
+    return ptr;
+  }
+
+  void free_cpu_copy(void *ptr) {
+    if (cpu_tier_files_ != nullptr && cpu_tier_files_->contains(ptr)) {
+      cudaHostUnregister(ptr);
+      cpu_tier_files_->release(ptr);
+      return;
+    }
+    cudaFreeHost(ptr);
+  }
+
+  // identifies the params file of a model by its size and modification time,
+  // so that a restored copy of an updated model is discarded. empty if the
+  // model is not found
+  static std::string model_source_version(const std::string &model_name) {
+    try {
+      const auto params_path = get_model_params_path(model_name);
+      struct stat sb;
+      if (stat(params_path.c_str(), &sb) != 0) {
+        return "";
+      }
+      return fmt::format("{}:{}.{}", sb.st_size, sb.st_mtim.tv_sec, sb.st_mtim.tv_nsec);
+    } catch (const dmlc::Error &) {
+      return "";
+    }
+  }
+
+  // makes the cpu copy restorable by the next run of uprd, if it is a file of
+  // UPRD_CPU_TIER_DIR. expects the copy to be fully written
+  void commit_cpu_copy(const std::string &model_name, const model_info *info) {
+    if (cpu_tier_files_ == nullptr || !cpu_tier_files_->contains(info->base_ptr)) {
+      return;
+    }
+    tier_file_index index;
+    index.model_name     = model_name;
+    index.source_version = model_source_version(model_name);
+    index.byte_count     = info->byte_count;
+    for (size_t ii = 0; ii < info->shapes.size(); ii++) {
+      const auto &shape = info->shapes[ii];
+      index.layers.push_back({info->layer_names[ii], std::vector<int64_t>(shape.begin(), shape.end()),
+                              info->offsets[ii], shape.Size() * element_size});
+    }
+    try {
+      cpu_tier_files_->commit(info->base_ptr, index);
+    } catch (const std::runtime_error &error) {
+      // the copy is still served, but it is not restored
+      LOG(ERROR) << "unable to commit the cpu tier file of " << model_name << ". " << error.what();
+    }
+  }
+
   void to_layers_from_model_info_for_model_granularity(::google::protobuf::RepeatedPtrField<Layer> *layers,
                                                        const model_info *info,
                                                        int64_t ref_count,
@@ -291,19 +575,32 @@ private:
     }
 
     void *device_ptr;
-    CUDA_CHECK_CALL(cudaMalloc(&device_ptr, info->byte_count),
-                    "cannot allocate to_layers_from_model_info_for_model_granularity");
-    CUDA_CHECK_CALL(cudaMemcpyAsync(device_ptr, info->base_ptr, info->byte_count, cudaMemcpyHostToDevice, stream),
-                    "cannot perform to_layers_from_model_info_for_model_granularity");
+    if (info->compressed != nullptr) {
+      device_ptr = decompress_to_device(info, stream);
+    } else {
+      CUDA_CHECK_CALL(cudaMalloc(&device_ptr, info->byte_count),
+                      "cannot allocate to_layers_from_model_info_for_model_granularity");
+      CUDA_CHECK_CALL(cudaMemcpyAsync(device_ptr, info->base_ptr, info->byte_count, cudaMemcpyHostToDevice, stream),
+                      "cannot perform to_layers_from_model_info_for_model_granularity");
+    }
+
+    to_layers_for_model_granularity(layers, info->layer_names, info->shapes, info->offsets, device_ptr, ref_count);
+  }
 
+  // describes the layers of a model whose weights are packed back to back in
+  // the device allocation device_ptr
+  void to_layers_for_model_granularity(::google::protobuf::RepeatedPtrField<Layer> *layers,
+                                       const std::vector<std::string> &layer_names,
+                                       const std::vector<TShape> &shapes, const std::vector<size_t> &offsets,
+                                       void *device_ptr, int64_t ref_count) {
     auto ipc_handle = make_ipc_handle(device_ptr);
 
-    layers->Reserve(info->layer_names.size());
-    for (size_t ii = 0; ii < info->layer_names.size(); ii++) {
+    layers->Reserve(layer_names.size());
+    for (size_t ii = 0; ii < layer_names.size(); ii++) {
       auto layer        = layers->Add();
-      const auto name   = info->layer_names[ii];
-      const auto tshape = info->shapes[ii];
-      const auto offset = info->offsets[ii];
+      const auto name   = layer_names[ii];
+      const auto tshape = shapes[ii];
+      const auto offset = offsets[ii];
 
       auto span = start_span("to_layer_from_cpu_mem", "convert",
                              span_props{{"ref_count", std::to_string(ref_count)},
@@ -338,10 +635,8 @@ private:
     }
   }
 
-  void load_from_cpu_mem(::google::protobuf::RepeatedPtrField<Layer> *layers, const std::string &model_name,
-                         int64_t ref_count, cudaStream_t stream = 0) {
-    auto e    = cpu_persistent_data.find(model_name);
-    auto info = e->second;
+  void load_from_cpu_mem(::google::protobuf::RepeatedPtrField<Layer> *layers, const model_info *info,
+                         int64_t ref_count, cudaStream_t stream = 0, size_t *shared_bytes = nullptr) {
     if (info->granularity == SharingGranularity_Layer) {
       layers->Reserve(info->layer_names.size());
       for (size_t ii = 0; ii < info->layer_names.size(); ii++) {
@@ -349,7 +644,8 @@ private:
         const auto layer_name = info->layer_names[ii];
         const auto cpu_ptr    = info->data[ii];
         const auto shape      = info->shapes[ii];
-        to_layer_from_cpu_mem(layer, layer_name, cpu_ptr, shape, ref_count);
+        const auto digest     = info->digests.empty() ? nullptr : &info->digests[ii];
+        to_layer_from_cpu_mem(layer, layer_name, cpu_ptr, shape, ref_count, stream, shared_bytes, digest);
       }
       return;
     }
@@ -361,22 +657,171 @@ private:
     throw std::runtime_error("invalid sharing granularity");
   }
 
-  bool is_persistent_on_cpu(const std::string &model_name) {
-    if (!UPRD_PERSIST_CPU) {
+  static size_t to_byte_count(const std::vector<NDArray> &arrays) {
+    size_t byte_count = 0;
+    for (const auto &array : arrays) {
+      byte_count += array.data().Size() * element_size;
+    }
+    return byte_count;
+  }
+
+  static compression_type cpu_compression() {
+    static const auto type = to_compression_type(UPRD_CPU_COMPRESSION);
+    return type;
+  }
+
+  // the channels a layer is quantized over. 0 if it is not quantized
+  static size_t num_channels(const TShape &shape) {
+    return shape.ndim() >= 2 ? shape[0] : 0;
+  }
+
+  // the bytes used by the cpu copy of a model granularity model
+  static size_t to_cpu_byte_count(const std::vector<TShape> &shapes) {
+    size_t byte_count = 0;
+    for (const auto &shape : shapes) {
+      byte_count += compressed_model::compressed_byte_count(cpu_compression(), shape.Size(), num_channels(shape));
+    }
+    return byte_count;
+  }
+
+  // builds a compressed cpu copy of a model granularity model from its layers,
+  // which are float32
+  model_info *to_compressed_model_info(const std::vector<const float *> &layers, const std::vector<TShape> &shapes,
+                                       const std::vector<std::string> &layer_names) {
+    auto span = start_span("compress_model", "load", span_props{{"num_layers", std::to_string(layers.size())}});
+    defer(stop_span(span));
+
+    auto info         = new model_info{};
+    info->granularity = SharingGranularity_Model;
+    info->compressed  = std::make_shared<compressed_model>(cpu_compression());
+    info->compressed->reserve(to_cpu_byte_count(shapes));
+
+    size_t offset = 0;
+    for (size_t ii = 0; ii < layers.size(); ii++) {
+      info->compressed->add(layers[ii], shapes[ii].Size(), num_channels(shapes[ii]));
+      info->shapes.emplace_back(shapes[ii]);
+      info->layer_names.emplace_back(layer_names[ii]);
+      info->offsets.emplace_back(offset);
+      offset += shapes[ii].Size() * element_size;
+    }
+    info->byte_count = info->compressed->byte_count();
+    return info;
+  }
+
+  // decompresses the cpu copy into a new device allocation. the decompression
+  // is split into chunks that are decompressed by UPRD_LOAD_IO_THREADS threads
+  // and transferred while the following chunks are decompressed
+  void *decompress_to_device(const model_info *info, cudaStream_t stream) {
+    const auto &compressed = info->compressed;
+
+    pipelined_copy::options opts;
+    // the chunks hold whole floats
+    opts.chunk_byte_count = std::max<size_t>(UPRD_LOAD_CHUNK_BYTES / sizeof(float), 1) * sizeof(float);
+    opts.num_io_threads   = UPRD_LOAD_IO_THREADS;
+    pipelined_copy copy(compressed->decompressed_byte_count(),
+                        [&compressed](size_t begin, size_t byte_count, char *dst) {
+                          compressed->decompress(begin, byte_count, dst);
+                        },
+                        opts);
+
+    void *device_ptr;
+    CUDA_CHECK_CALL(cudaMalloc(&device_ptr, std::max(copy.byte_count(), size_t{1})),
+                    "cannot allocate decompress_to_device");
+    try {
+      copy.run(device_ptr, stream, [](const char *stage, size_t chunk) -> std::function<void()> {
+        auto span = start_span(stage, "decompress", span_props{{"chunk", std::to_string(chunk)}});
+        return [span]() { stop_span(span); };
+      });
+    } catch (...) {
+      cudaFree(device_ptr);
+      throw;
+    }
+    return device_ptr;
+  }
+
+  void free_model_info(model_info *info) {
+    if (info->compressed != nullptr) {
+      // the compressed copy is freed with the model_info
+    } else if (info->granularity == SharingGranularity_Model) {
+      free_cpu_copy(info->base_ptr);
+    } else {
+      for (auto ptr : info->data) {
+        cudaFreeHost(ptr);
+      }
+    }
+    delete info;
+  }
+
+  // expects the cpu lock to be held
+  void evict_from_cpu(const std::string &model_name) {
+    auto it = cpu_persistent_data.find(model_name);
+    CHECK(it != cpu_persistent_data.end()) << "expecting " << model_name << " to be persisted on cpu";
+    LOG(INFO) << "evicting " << model_name << " from the cpu tier";
+    cpu_evictions_.add();
+    cpu_memory_usage_ -= it->second->byte_count;
+    cpu_eviction_index_->erase(model_name);
+    free_model_info(it->second);
+    cpu_persistent_data.erase(it);
+  }
+
+  // makes room for byte_count bytes in the cpu tier and reserves them. returns
+  // false if the bytes do not fit even after evicting every unpinned model.
+  // expects the cpu lock to be held
+  bool reserve_on_cpu(size_t byte_count) {
+    const auto limit = cpu_memory_limit();
+    if (byte_count > limit) {
+      return false;
+    }
+    std::string victim;
+    while (cpu_memory_usage_ + byte_count > limit && cpu_eviction_index_->victim(&victim)) {
+      evict_from_cpu(victim);
+    }
+    if (cpu_memory_usage_ + byte_count > limit) {
       return false;
     }
-    return cpu_persistent_data.find(model_name) != cpu_persistent_data.end();
+    cpu_memory_usage_ += byte_count;
+    return true;
   }
 
-  void persist_on_cpu(const std::string &model_name, const NDArray &array, const std::string &layer_name) {
-    if (cpu_persistent_data.find(model_name) == cpu_persistent_data.end()) {
-      auto info         = new model_info{};
-      info->granularity = SharingGranularity_Layer;
-      cpu_persistent_data.insert({model_name, info});
+  void unreserve_on_cpu(size_t byte_count) {
+    std::lock_guard<std::mutex> lock(cpu_persistent_data_mutex_);
+    cpu_memory_usage_ -= byte_count;
+  }
+
+  // publishes a model_info whose bytes were reserved with reserve_on_cpu
+  void publish_on_cpu(const std::string &model_name, model_info *info) {
+    std::lock_guard<std::mutex> lock(cpu_persistent_data_mutex_);
+    if (cpu_persistent_data.find(model_name) != cpu_persistent_data.end()) {
+      cpu_memory_usage_ -= info->byte_count;
+      free_model_info(info);
+      return;
+    }
+    cpu_persistent_data.insert({model_name, info});
+    cpu_eviction_index_->insert(model_name, info->byte_count);
+  }
+
+  // returns the cpu copy of the model and pins it, so that it is not evicted
+  // from the cpu tier while being copied to the device. returns nullptr if the
+  // model is not persisted on cpu
+  model_info *acquire_persistent_on_cpu(const std::string &model_name) {
+    if (!UPRD_PERSIST_CPU) {
+      return nullptr;
     }
-    auto e    = cpu_persistent_data.find(model_name);
-    auto info = e->second;
+    std::lock_guard<std::mutex> lock(cpu_persistent_data_mutex_);
+    auto e = cpu_persistent_data.find(model_name);
+    if (e == cpu_persistent_data.end()) {
+      return nullptr;
+    }
+    cpu_eviction_index_->acquire(model_name);
+    return e->second;
+  }
 
+  void release_persistent_on_cpu(const std::string &model_name) {
+    std::lock_guard<std::mutex> lock(cpu_persistent_data_mutex_);
+    cpu_eviction_index_->release(model_name);
+  }
+
+  void persist_on_cpu(model_info *info, const NDArray &array, const std::string &layer_name) {
     const auto blob       = array.data();
     const auto byte_count = blob.Size() * element_size;
     void *arry_ptr        = (void *) blob.dptr_;
@@ -386,50 +831,213 @@ private:
     CUDA_CHECK_CALL(cudaMallocHost(&arry_cpy, byte_count, cudaHostAllocWriteCombined),
                     "failed to allocate pinned cpu memory");
     memcpy(arry_cpy, arry_ptr, byte_count);
+    if (UPRD_DEDUP_LAYERS) {
+      info->digests.emplace_back(digest_layer(arry_ptr, byte_count));
+    }
 
     info->shapes.emplace_back(array.shape());
-    info->data.emplace_back(arry_ptr);
+    info->data.emplace_back(arry_cpy);
     info->layer_names.emplace_back(layer_name);
+    info->byte_count += byte_count;
   }
 
+  // the model_info is fully populated before being published, so that a
+  // concurrent reader never observes a partially persisted model. the model is
+  // not persisted if it does not fit in the cpu tier
   void persist_on_cpu(const SharingGranularity &sharing_granularity, const std::string &model_name,
                       const std::vector<NDArray> &arrays, const std::vector<std::string> &layer_names) {
-    if (sharing_granularity == SharingGranularity_Layer) {
-      size_t ii = 0;
-      for (const auto &array : arrays) {
-        const auto layer_name = layer_names[ii++];
-        persist_on_cpu(model_name, array, layer_name);
-      }
-      return;
+    if (sharing_granularity != SharingGranularity_Layer && sharing_granularity != SharingGranularity_Model) {
+      throw std::runtime_error("invalid sharing granularity");
     }
-    if (sharing_granularity == SharingGranularity_Model) {
-      auto info = to_model_info_for_model_sharing_granularity(arrays, layer_names);
-      cpu_persistent_data.insert({model_name, info});
-      return;
+
+    // only model granularity copies are compressed
+    const bool compress = sharing_granularity == SharingGranularity_Model && cpu_compression() != compression_type::none;
+    std::vector<TShape> shapes{};
+    for (const auto &array : arrays) {
+      shapes.emplace_back(array.shape());
+    }
+    const auto byte_count = compress ? to_cpu_byte_count(shapes) : to_byte_count(arrays);
+    {
+      std::lock_guard<std::mutex> lock(cpu_persistent_data_mutex_);
+      if (cpu_persistent_data.find(model_name) != cpu_persistent_data.end()) {
+        return;
+      }
+      if (!reserve_on_cpu(byte_count)) {
+        LOG(INFO) << "not persisting " << model_name << " on cpu, since its " << byte_count
+                  << " bytes do not fit in the cpu tier";
+        return;
+      }
     }
 
-    throw std::runtime_error("invalid sharing granularity");
+    model_info *info = nullptr;
+    try {
+      if (sharing_granularity == SharingGranularity_Layer) {
+        info              = new model_info{};
+        info->granularity = SharingGranularity_Layer;
+        size_t ii         = 0;
+        for (const auto &array : arrays) {
+          const auto layer_name = layer_names[ii++];
+          persist_on_cpu(info, array, layer_name);
+        }
+      } else if (compress) {
+        std::vector<const float *> layers{};
+        for (const auto &array : arrays) {
+          layers.emplace_back((const float *) array.data().dptr_);
+        }
+        info = to_compressed_model_info(layers, shapes, layer_names);
+      } else {
+        info = to_model_info_for_model_sharing_granularity(arrays, layer_names, model_name);
+      }
+    } catch (...) {
+      // frees the layers persisted before the failure
+      if (info != nullptr) {
+        free_model_info(info);
+      }
+      unreserve_on_cpu(byte_count);
+      throw;
+    }
+    publish_on_cpu(model_name, info);
   }
 
-  void load_ndarray(::google::protobuf::RepeatedPtrField<Layer> *layers, const ModelRequest *request, int64_t ref_count,
-                    cudaStream_t stream = 0) {
+  // copies a model that is evicted from the device into the cpu tier, so that
+  // it is reloaded from host memory rather than from disk. runs on
+  // demotion_worker_ without holding the registry lock. free_device may be
+  // called once the weights are copied, before they are compressed; otherwise
+  // the device memory is freed on return.
+  // only model granularity is demoted, since the layers are then contiguous
+  void demote_to_cpu(const std::string &model_name, const ModelHandle &owned,
+                     const std::function<void()> &free_device) {
+    if (!UPRD_PERSIST_CPU || owned.sharing_granularity() != SharingGranularity_Model) {
+      return;
+    }
+    const auto byte_count = static_cast<size_t>(owned.byte_count());
+    std::vector<TShape> shapes{};
+    for (const auto &layer : owned.layer()) {
+      const auto &dims = layer.shape().dim();
+      shapes.emplace_back(TShape(dims.begin(), dims.end()));
+    }
+    const bool compress       = cpu_compression() != compression_type::none;
+    const auto cpu_byte_count = compress ? to_cpu_byte_count(shapes) : byte_count;
+    {
+      std::lock_guard<std::mutex> lock(cpu_persistent_data_mutex_);
+      if (cpu_persistent_data.find(model_name) != cpu_persistent_data.end() || !reserve_on_cpu(cpu_byte_count)) {
+        return;
+      }
+    }
 
-    const auto model_name = request->name();
+    auto span = start_span("demote_to_cpu", "destroy", span_props{{"model_name", model_name}});
+    defer(stop_span(span));
 
-    if (is_persistent_on_cpu(model_name)) {
-      auto layers_span = start_span("to_layers_from_cpu_mem", "load",
-                                    span_props{{"ref_count", std::to_string(ref_count)}, {"mode_name", model_name}});
-      load_from_cpu_mem(layers, model_name, ref_count);
-      stop_span(layers_span);
+    if (compress) {
+      // the weights are compressed from a pageable copy, since reading write
+      // combined memory is slow
+      std::vector<char> weights(byte_count);
+      if (cudaMemcpy(weights.data(), (void *) owned.device_raw_ptr(), byte_count, cudaMemcpyDeviceToHost) !=
+          cudaSuccess) {
+        LOG(ERROR) << "unable to copy " << model_name << " to the cpu tier";
+        unreserve_on_cpu(cpu_byte_count);
+        return;
+      }
+      // the loads waiting for the device memory do not wait for the
+      // compression, which is proportional to the size of the model
+      free_device();
+      std::vector<const float *> layers{};
+      std::vector<std::string> layer_names{};
+      for (const auto &layer : owned.layer()) {
+        layers.emplace_back((const float *) (weights.data() + layer.offset()));
+        layer_names.emplace_back(layer.name());
+      }
+      model_info *info = nullptr;
+      try {
+        info = to_compressed_model_info(layers, shapes, layer_names);
+      } catch (...) {
+        unreserve_on_cpu(cpu_byte_count);
+        throw;
+      }
+      LOG(INFO) << "demoted " << model_name << " to the cpu tier, compressed from " << byte_count << " to "
+                << info->byte_count << " bytes";
+      demotions_.add();
+      publish_on_cpu(model_name, info);
+      return;
+    }
+
+    void *base_ptr = allocate_cpu_copy(model_name, byte_count);
+    if (base_ptr == nullptr) {
+      LOG(ERROR) << "unable to allocate pinned memory to demote " << model_name << " to the cpu tier";
+      unreserve_on_cpu(byte_count);
+      return;
+    }
+    if (cudaMemcpy(base_ptr, (void *) owned.device_raw_ptr(), byte_count, cudaMemcpyDeviceToHost) != cudaSuccess) {
+      LOG(ERROR) << "unable to copy " << model_name << " to the cpu tier";
+      free_cpu_copy(base_ptr);
+      unreserve_on_cpu(byte_count);
       return;
     }
 
-    auto directory_path = request->directory_path();
+    auto info         = new model_info{};
+    info->granularity = SharingGranularity_Model;
+    info->base_ptr    = base_ptr;
+    info->byte_count  = byte_count;
+    for (const auto &layer : owned.layer()) {
+      const auto &dims = layer.shape().dim();
+      info->shapes.emplace_back(TShape(dims.begin(), dims.end()));
+      info->data.emplace_back(((char *) base_ptr) + layer.offset());
+      info->layer_names.emplace_back(layer.name());
+      info->offsets.emplace_back(layer.offset());
+    }
+    commit_cpu_copy(model_name, info);
 
-    auto span = start_span("load_ndarray", "load",
-                           span_props{{"ref_count", std::to_string(ref_count)}, {"mode_name", model_name}});
+    LOG(INFO) << "demoted " << model_name << " to the cpu tier";
+    demotions_.add();
+    publish_on_cpu(model_name, info);
+  }
+
+  // maps the params file and returns cpu arrays that point into the mapping.
+  // returns nullptr if the file cannot be mapped, for example if it holds
+  // sparse or non float32 arrays
+  std::shared_ptr<mapped_params_file> map_params(const std::string &params_path, std::vector<NDArray> *arrays,
+                                                 std::vector<std::string> *layer_names) {
+    auto span = start_span("map_params", "load", span_props{{"params_path", params_path}});
     defer(stop_span(span));
 
+    std::shared_ptr<mapped_params_file> mapping{nullptr};
+    try {
+      mapping = std::make_shared<mapped_params_file>(params_path);
+    } catch (const std::exception &error) {
+      LOG(INFO) << "falling back to reading " << params_path << ". " << error.what();
+      return nullptr;
+    }
+    if (UPR_VERIFY_PACKED_MODELS && mapping->is_packed()) {
+      // fails the load, since a packed model cannot be read any other way
+      verify_packed_arrays(mapping->arrays());
+    }
+    for (const auto &array : mapping->arrays()) {
+      if (array.type_flag != mshadow::kFloat32 || array.shape.empty()) {
+        LOG(INFO) << "falling back to reading " << params_path << ", since it holds non float32 arrays";
+        return nullptr;
+      }
+    }
+
+    arrays->reserve(mapping->arrays().size());
+    layer_names->reserve(mapping->arrays().size());
+    for (const auto &array : mapping->arrays()) {
+      const TShape shape(array.shape.begin(), array.shape.end());
+      // the mapping is read only. the arrays are only used as a copy source
+      const TBlob blob((void *) array.data, shape, cpu::kDevMask, array.type_flag);
+      arrays->emplace_back(blob, 0);
+      layer_names->emplace_back(array.name);
+    }
+    return mapping;
+  }
+
+  // reads the parameters of the model. with UPRD_MMAP_PARAMS the arrays point
+  // into a mapping of the params file, which is returned and must outlive
+  // their use
+  std::shared_ptr<mapped_params_file> read_params(const ModelRequest *request, int64_t ref_count,
+                                                  std::vector<NDArray> *arrays, std::vector<std::string> *layer_names) {
+    const auto model_name = request->name();
+    auto directory_path   = request->directory_path();
+
     // LOG(INFO) << fmt::format("loading ndarray directory_path = {} and
     // model_name = {}", directory_path, model_name);
     if (directory_path == "" && model_name == "") {
@@ -466,12 +1074,22 @@ private:
     // LOG(INFO) << fmt::format("performing an ndarray load with params={} and
     // symbol={} paths", params_path, symbol_path);
 
-    std::vector<NDArray> arrays{};
-    std::vector<std::string> layer_names{};
+    // packed models can only be read through a mapping
+    const auto packed = is_packed_model_file(params_path);
+    if (UPRD_MMAP_PARAMS || packed) {
+      auto mapping = map_params(params_path, arrays, layer_names);
+      if (mapping != nullptr) {
+        return mapping;
+      }
+      if (packed) {
+        throw std::runtime_error(fmt::format("unable to map the packed model {}", params_path));
+      }
+    }
+
     auto stream_span = start_span("create_dmlc_stream", "load",
                                   span_props{{"ref_count", std::to_string(ref_count)}, {"mode_name", model_name}});
 
-    dmlc::Stream *fi(dmlc::Stream::Create(params_path.c_str(), "r", true));
+    std::unique_ptr<dmlc::Stream> fi(dmlc::Stream::Create(params_path.c_str(), "r", true));
     if (fi == nullptr) {
       const auto msg = fmt::format("unable to create a stream for {}", params_path);
       LOG(ERROR) << msg;
@@ -479,7 +1097,80 @@ private:
     }
     stop_span(stream_span);
 
-    NDArray::Load(fi, &arrays, &layer_names);
+    NDArray::Load(fi.get(), arrays, layer_names);
+    return nullptr;
+  }
+
+  // copies the weights straight from the params mapping to the device. the
+  // file is read in chunks by UPRD_LOAD_IO_THREADS threads into pinned staging
+  // buffers, and each chunk is transferred while the following ones are read
+  void to_layers_from_mapping_for_model_granularity(::google::protobuf::RepeatedPtrField<Layer> *layers,
+                                                    const std::string &model_name, const mapped_params_file &mapping,
+                                                    const std::vector<NDArray> &arrays,
+                                                    const std::vector<std::string> &layer_names, int64_t ref_count,
+                                                    cudaStream_t stream = 0) {
+    pipelined_copy::options opts;
+    opts.chunk_byte_count = UPRD_LOAD_CHUNK_BYTES;
+    opts.num_io_threads   = UPRD_LOAD_IO_THREADS;
+    pipelined_copy copy(mapping, opts);
+
+    std::vector<TShape> shapes{};
+    std::vector<size_t> offsets{};
+    size_t offset = 0;
+    for (const auto &array : arrays) {
+      shapes.emplace_back(array.shape());
+      offsets.emplace_back(offset);
+      offset += array.shape().Size() * element_size;
+    }
+
+    void *device_ptr;
+    CUDA_CHECK_CALL(cudaMalloc(&device_ptr, copy.byte_count()),
+                    "cannot allocate to_layers_from_mapping_for_model_granularity");
+
+    const auto trace = [&](const char *stage, size_t chunk) -> std::function<void()> {
+      auto span = start_span(stage, "load", span_props{{"mode_name", model_name}, {"chunk", std::to_string(chunk)}});
+      return [span]() { stop_span(span); };
+    };
+    pipelined_copy::timings timings;
+    try {
+      timings = copy.run(device_ptr, stream, trace);
+    } catch (...) {
+      cudaFree(device_ptr);
+      throw;
+    }
+    LOG(INFO) << fmt::format("copied {} bytes of {} to the device. read = {}us, wait_for_read = {}us, transfer = {}us",
+                             copy.byte_count(), model_name, timings.read, timings.wait_for_read, timings.transfer);
+
+    to_layers_for_model_granularity(layers, layer_names, shapes, offsets, device_ptr, ref_count);
+  }
+
+  // loads the layers of the model. shared_bytes is incremented by the bytes of
+  // the layers that share the allocation of an already resident layer
+  void load_ndarray(::google::protobuf::RepeatedPtrField<Layer> *layers, const ModelRequest *request, int64_t ref_count,
+                    cudaStream_t stream = 0, size_t *shared_bytes = nullptr) {
+
+    const auto model_name = request->name();
+
+    auto persisted = acquire_persistent_on_cpu(model_name);
+    if (persisted != nullptr) {
+      defer(release_persistent_on_cpu(model_name));
+      cpu_tier_loads_.add();
+      auto layers_span = start_span("to_layers_from_cpu_mem", "load",
+                                    span_props{{"ref_count", std::to_string(ref_count)}, {"mode_name", model_name}});
+      load_from_cpu_mem(layers, persisted, ref_count, stream, shared_bytes);
+      // the cpu copy may be evicted once it is released
+      CUDA_CHECK_CALL(cudaStreamSynchronize(stream), "failed to synchronize stream");
+      stop_span(layers_span);
+      return;
+    }
+
+    auto span = start_span("load_ndarray", "load",
+                           span_props{{"ref_count", std::to_string(ref_count)}, {"mode_name", model_name}});
+    defer(stop_span(span));
+
+    std::vector<NDArray> arrays{};
+    std::vector<std::string> layer_names{};
+    const auto mapping = read_params(request, ref_count, &arrays, &layer_names);
 
     // LOG(INFO) << "starting to convert " << arrays.size() << " ndarrays to
     // protobuf representation";
@@ -506,17 +1197,27 @@ private:
       for (const auto &array : arrays) {
         const auto layer_name = layer_names[ii++];
         auto layer            = layers->Add();
-        to_layer_from_disk(layer, layer_name, array, ref_count, stream);
+        to_layer_from_disk(layer, layer_name, array, ref_count, stream, shared_bytes);
+      }
+      // the copies read from the params mapping, which is released on return
+      if (mapping != nullptr) {
+        CUDA_CHECK_CALL(cudaStreamSynchronize(stream), "failed to synchronize stream");
       }
     } else if (sharing_granularity == SharingGranularity_Model) {
-      if (is_persistent_on_cpu(model_name)) {
-        auto e    = cpu_persistent_data.find(model_name);
-        auto info = e->second;
+      auto info = acquire_persistent_on_cpu(model_name);
+      if (info != nullptr) {
+        // released even if the copy throws, so the cpu copy can still be demoted or evicted
+        defer(release_persistent_on_cpu(model_name));
         to_layers_from_model_info_for_model_granularity(layers, info, ref_count, stream);
+        CUDA_CHECK_CALL(cudaStreamSynchronize(stream), "failed to synchronize stream");
+      } else if (mapping != nullptr && UPRD_PIPELINED_LOAD) {
+        to_layers_from_mapping_for_model_granularity(layers, model_name, *mapping, arrays, layer_names, ref_count,
+                                                     stream);
       } else {
-        auto info = to_model_info_for_model_sharing_granularity(arrays, layer_names);
+        info = to_model_info_for_model_sharing_granularity(arrays, layer_names);
+        defer(free_model_info(info));
         to_layers_from_model_info_for_model_granularity(layers, info, ref_count, stream);
-        delete info;
+        CUDA_CHECK_CALL(cudaStreamSynchronize(stream), "failed to synchronize stream");
       }
     } else {
       throw std::runtime_error("invalid sharing granularity");
@@ -524,13 +1225,93 @@ private:
     stop_span(layers_span);
   }
 
-  void from_owned_layer(Layer *layer, const Layer &owned, int64_t ref_count) {
+  // places all the model weights into a single posix shared memory segment.
+  // clients map the segment read-only and build ndarrays from the layer offsets,
+  // so no cuda call is made on this path
+  void load_ndarray_to_shared_memory(ModelHandle *owned, const ModelRequest *request) {
+    const auto model_name = request->name();
 
-    const auto id    = sole::uuid4().str();
-    const auto shape = layer->mutable_shape();
+    auto span = start_span("load_ndarray_to_shared_memory", "load", span_props{{"mode_name", model_name}});
+    defer(stop_span(span));
 
-    //auto span = start_span("from_owned_layer", "load",
-     //                      span_props{{"ref_count", std::to_string(ref_count)}, {"name", layer->name()}});
+    std::vector<NDArray> arrays{};
+    std::vector<std::string> layer_names{};
+    const auto mapping = read_params(request, /*ref_count=*/-1, &arrays, &layer_names);
+
+    size_t total_byte_count = 0;
+    for (const auto &array : arrays) {
+      total_byte_count += array.data().Size() * element_size;
+    }
+
+    const auto shm_name = get_shared_memory_name(owned->model_id());
+    const int fd        = shm_open(shm_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd == -1) {
+      throw std::runtime_error(fmt::format("unable to create shared memory segment {}. shm_open failed with error {}",
+                                           shm_name, strerror(errno)));
+    }
+    defer(close(fd));
+
+    // mmap does not accept zero sized mappings
+    const size_t segment_size = std::max(total_byte_count, size_t{1});
+    if (ftruncate(fd, segment_size) != 0) {
+      shm_unlink(shm_name.c_str());
+      throw std::runtime_error(fmt::format("unable to resize shared memory segment {} to {} bytes. error {}", shm_name,
+                                           segment_size, strerror(errno)));
+    }
+    void *base_ptr = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base_ptr == MAP_FAILED) {
+      shm_unlink(shm_name.c_str());
+      throw std::runtime_error(
+          fmt::format("unable to map shared memory segment {}. error {}", shm_name, strerror(errno)));
+    }
+
+    auto layers = owned->mutable_layer();
+    layers->Reserve(arrays.size());
+
+    size_t offset = 0;
+    for (size_t ii = 0; ii < arrays.size(); ii++) {
+      const auto blob       = arrays[ii].data();
+      const auto byte_count = blob.Size() * element_size;
+
+      memcpy(((char *) base_ptr) + offset, blob.dptr_, byte_count);
+
+      auto layer = layers->Add();
+      layer->set_id(sole::uuid4().str());
+      layer->set_name(layer_names[ii]);
+      to_shape(layer->mutable_shape(), arrays[ii].shape());
+      layer->set_byte_count(byte_count);
+      layer->set_offset(offset);
+      layer->set_device_raw_ptr((int64_t) base_ptr);
+      layer->set_sharing_granularity(SharingGranularity_Model);
+      layer->set_ref_count(-1);
+
+      offset += byte_count;
+    }
+
+    owned->set_memory_backend(MemoryBackend_CPUShared);
+    owned->set_shared_memory_name(shm_name);
+    owned->set_device_raw_ptr((int64_t) base_ptr);
+  }
+
+  void release_shared_memory(const ModelHandle &owned) {
+    void *base_ptr = (void *) owned.device_raw_ptr();
+    if (base_ptr != nullptr) {
+      munmap(base_ptr, std::max((size_t) owned.byte_count(), size_t{1}));
+    }
+    // clients that still have the segment mapped keep their view alive
+    if (shm_unlink(owned.shared_memory_name().c_str()) != 0) {
+      LOG(ERROR) << "unable to unlink shared memory segment " << owned.shared_memory_name() << ". error "
+                 << strerror(errno);
+    }
+  }
+
+  void from_owned_layer(Layer *layer, const Layer &owned, int64_t ref_count) {
+
+    const auto id    = sole::uuid4().str();
+    const auto shape = layer->mutable_shape();
+
+    //auto span = start_span("from_owned_layer", "load",
+     //                      span_props{{"ref_count", std::to_string(ref_count)}, {"name", layer->name()}});
 
     // LOG(INFO) << "loading from owned layer for layer " << owned.name() << "
     // with ref_count = " << ref_count;
@@ -572,12 +1353,14 @@ private:
     handle->set_device_raw_ptr(owned.device_raw_ptr());
     handle->set_name(owned.name());
     handle->set_needed_eviction(owned.needed_eviction());
+    handle->set_memory_backend(owned.memory_backend());
+    handle->set_shared_memory_name(owned.shared_memory_name());
 
     // LOG(INFO) << "loading from owned model";
 
     auto layers = handle->mutable_layer();
 
-    if (owned.sharing_granularity() == SharingGranularity_Model) {
+    if (owned.memory_backend() == MemoryBackend_CUDA && owned.sharing_granularity() == SharingGranularity_Model) {
       const auto ipc_handle = make_ipc_handle((float *) owned.device_raw_ptr());
       handle->set_ipc_handle(ipc_handle.reserved, CUDA_IPC_HANDLE_SIZE);
     }
@@ -591,152 +1374,146 @@ private:
     stop_span(span);
   }
 
-  size_t estimate_model_size(const ModelRequest *request) {
-    static const auto estimation_rate = UPRD_ESTIMATION_RATE;
-    const auto model_name             = request->name();
-    const auto params_path            = get_model_params_path(model_name);
-    const auto internal_memory_usage  = get_model_internal_memory_usage(model_name);
-
-    auto span = start_span("estimate_model_size", "load",
-                           span_props{{"estimation_rate", std::to_string(estimation_rate)},
-                                      {"model_name", request->name()},
-                                      {"internal_memory_usage", std::to_string(internal_memory_usage)}});
-    defer(stop_span(span));
-
-    std::ifstream in(params_path, std::ifstream::ate | std::ifstream::binary);
-    return in.tellg() * estimation_rate + internal_memory_usage;
+  // the input shape declared in the model manifest, or 1xCxHxW from the
+  // UPR_INPUT_* variables
+  static mxnet::TShape estimation_input_shape(const std::string &model_name) {
+    catalog_entry entry;
+    if (get_model_catalog().find(model_name, &entry) && !entry.input_shape.empty()) {
+      return mxnet::TShape(entry.input_shape.begin(), entry.input_shape.end());
+    }
+    return mxnet::TShape({1, (dim_t) UPR_INPUT_CHANNELS, (dim_t) UPR_INPUT_HEIGHT, (dim_t) UPR_INPUT_WIDTH});
   }
 
-  bool perform_no_eviction(const ModelRequest *request, const size_t memory_size_request, const size_t memory_to_free) {
-    return false;
+  static std::string memory_estimate_key(const std::string &model_name) {
+    std::string key = model_name;
+    for (const auto dim : estimation_input_shape(model_name)) {
+      key += fmt::format(":{}", dim);
+    }
+    return key;
   }
 
-  bool perform_lru_eviction(const ModelRequest *request, const size_t memory_size_request,
-                            const size_t memory_to_free) {
-    size_t memory_freed = 0;
-    bool ret            = false;
+  // computes the estimate of a model that is not in memory_estimates_. falls
+  // back to the params file size and the model_internal_memory_usage table if
+  // the graph cannot be analyzed
+  graph_memory_estimate compute_memory_estimate(const std::string &model_name) {
+    auto span = start_span("estimate_graph_memory", "load", span_props{{"model_name", model_name}});
+    defer(stop_span(span));
 
-    while (memory_freed < memory_to_free) {
-      if (memory_db_.empty()) {
-        break;
+    try {
+      const auto symbol_path = get_model_symbol_path(model_name);
+      std::ifstream in(symbol_path);
+      if (!in.is_open()) {
+        throw std::runtime_error(fmt::format("unable to open {}", symbol_path));
       }
-      auto min_element = std::min_element(memory_db_.begin(), memory_db_.end(),
-                                          [](const memory_db_t::value_type &s1, const memory_db_t::value_type &s2) {
-                                            if (s1.second->ref_count() > 0) {
-                                              return false;
-                                            }
-                                            return s1.second->lru_timestamp() < s2.second->lru_timestamp();
-                                          });
-      if (min_element == memory_db_.end()) {
-        break;
-      }
-      auto model            = min_element->second;
-      const auto byte_count = model->owned_model().byte_count();
-      memory_usage_ -= byte_count;
-      memory_freed += byte_count;
-      model_delete(model);
-      memory_db_.erase(min_element);
+      const std::string symbol_json((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+      auto estimate = estimate_graph_memory(symbol_json, "data", estimation_input_shape(model_name));
+      LOG(INFO) << "estimated " << model_name << " to use " << estimate.param_bytes << " bytes of parameters and "
+                << estimate.activation_bytes << " bytes of activations";
+      return estimate;
+    } catch (const std::exception &error) {
+      LOG(ERROR) << "unable to estimate the memory of " << model_name << " from its graph. " << error.what();
     }
 
-    if (memory_freed >= memory_to_free) {
-      ret = true;
+    graph_memory_estimate estimate;
+    std::ifstream in(get_model_params_path(model_name), std::ifstream::ate | std::ifstream::binary);
+    estimate.param_bytes = std::max<std::streamoff>(in.tellg(), 0);
+    try {
+      estimate.activation_bytes = get_model_internal_memory_usage(model_name);
+    } catch (const std::exception &error) {
+      LOG(ERROR) << error.what();
     }
-
-    return ret;
+    return estimate;
   }
 
-  bool perform_fifo_eviction(const ModelRequest *request, const size_t memory_size_request,
-                             const size_t memory_to_free) {
-    size_t memory_freed = 0;
-    bool ret            = false;
-
-    while (memory_freed < memory_to_free) {
-      if (memory_db_.empty()) {
-        break;
-      }
-      auto min_element = std::min_element(memory_db_.begin(), memory_db_.end(),
-                                          [](const memory_db_t::value_type &s1, const memory_db_t::value_type &s2) {
-                                            if (s1.second->ref_count() > 0) {
-                                              return false;
-                                            }
-                                            return s1.second->fifo_order() < s2.second->fifo_order();
-                                          });
-      if (min_element == memory_db_.end()) {
-        break;
+  // returns the cached estimate of the model, or computes and caches it. the
+  // graph is analyzed without holding any lock, so this is called before the
+  // registry lock is taken
+  graph_memory_estimate get_memory_estimate(const std::string &model_name) {
+    const auto key = memory_estimate_key(model_name);
+    {
+      std::lock_guard<std::mutex> lock(memory_estimates_mutex_);
+      auto it = memory_estimates_.find(key);
+      if (it != memory_estimates_.end()) {
+        return it->second;
       }
-      auto model            = min_element->second;
-      const auto byte_count = model->owned_model().byte_count();
-      memory_usage_ -= byte_count;
-      memory_freed += byte_count;
-      model_delete(model);
-      memory_db_.erase(min_element);
     }
+    const auto estimate = compute_memory_estimate(model_name);
+    std::lock_guard<std::mutex> lock(memory_estimates_mutex_);
+    // an estimate refined by a concurrent load is kept
+    return memory_estimates_.emplace(key, estimate).first->second;
+  }
 
-    if (memory_freed >= memory_to_free) {
-      ret = true;
-    }
+  size_t estimate_model_size(const ModelRequest *request, const graph_memory_estimate &estimate) {
+    static const auto estimation_rate = UPRD_ESTIMATION_RATE;
+    const auto internal_memory_usage = UPRD_ESTIMATE_WITH_INTERNAL_MEMORY ? estimate.activation_bytes : 0;
 
-    return ret;
-  }
+    auto span = start_span("estimate_model_size", "load",
+                           span_props{{"estimation_rate", std::to_string(estimation_rate)},
+                                      {"model_name", request->name()},
+                                      {"internal_memory_usage", std::to_string(internal_memory_usage)}});
+    defer(stop_span(span));
 
-  bool perform_flush_eviction(const ModelRequest *request, const size_t memory_size_request,
-                              const size_t memory_to_free) {
-    size_t memory_freed = 0;
-    for (const auto &elem : memory_db_) {
-      auto model            = elem.second;
-      const auto byte_count = model->owned_model().byte_count();
-      memory_usage_ -= byte_count;
-      memory_freed += byte_count;
-      model_delete(model);
-    }
-    memory_db_.clear();
+    return estimate.param_bytes * estimation_rate + internal_memory_usage;
+  }
 
-    return memory_freed >= memory_to_free;
+  // replaces the predicted parameter bytes with the measured ones once the
+  // model is loaded
+  void refine_memory_estimate(const Model *model) {
+    std::lock_guard<std::mutex> lock(memory_estimates_mutex_);
+    auto &estimate       = memory_estimates_[memory_estimate_key(model->name())];
+    estimate.param_bytes = model->owned_model().byte_count();
   }
 
-  bool perform_lcu_eviction(const ModelRequest *request, const size_t memory_size_request,
-                            const size_t memory_to_free) {
-    size_t memory_freed = 0;
-    bool ret            = false;
+  // handle ids are {model_id}#{n}. the model id changes every time the model is
+  // loaded, so a handle issued before an eviction is never mistaken for one of
+  // the current load
+  static std::string make_handle_id(const std::string &model_id, uint64_t handle) {
+    return fmt::format("{}#{}", model_id, handle);
+  }
 
-    while (memory_freed < memory_to_free) {
-      if (memory_db_.empty()) {
-        break;
-      }
-      auto min_element = std::min_element(memory_db_.begin(), memory_db_.end(),
-                                          [](const memory_db_t::value_type &s1, const memory_db_t::value_type &s2) {
-                                            if (s1.second->ref_count() > 0) {
-                                              return false;
-                                            }
-                                            return s1.second->use_history().size() < s2.second->use_history().size();
-                                          });
-      if (min_element == memory_db_.end()) {
-        break;
-      }
-      auto model            = min_element->second;
-      const auto byte_count = model->owned_model().byte_count();
-      memory_usage_ -= byte_count;
-      memory_freed += byte_count;
-      model_delete(model);
-      memory_db_.erase(min_element);
+  static bool parse_handle_id(const std::string &handle_id, const std::string &model_id, uint64_t *handle) {
+    const auto sep = handle_id.rfind('#');
+    if (sep == std::string::npos || handle_id.compare(0, sep, model_id) != 0 || sep + 1 == handle_id.size()) {
+      return false;
     }
+    char *end = nullptr;
+    *handle   = std::strtoull(handle_id.c_str() + sep + 1, &end, 10);
+    return *end == '\0';
+  }
 
-    if (memory_freed >= memory_to_free) {
-      ret = true;
-    }
+  // removes an unpinned model from the registry and returns the number of bytes freed
+  size_t evict_model(const std::string &model_name) {
+    auto it = memory_db_.find(model_name);
+    CHECK(it != memory_db_.end()) << "expecting " << model_name << " to be resident";
 
-    return ret;
+    auto model = it->second;
+    CHECK(model->ref_count() == 0) << "cannot evict " << model_name << " while it is in use";
+
+    latency_timer timer(&evict_latency_);
+    // layers shared with other resident models stay allocated
+    const auto byte_count = model_delete(model);
+    evictions_.add();
+    evicted_bytes_.add(byte_count);
+    memory_usage_ -= byte_count;
+    resident_.erase(model->id());
+    memory_db_.erase(it);
+    eviction_index_->erase(model_name);
+    delete model;
+
+    return byte_count;
   }
 
   // A eviction few strategies
   // - NEVER
   // - LRU
   // - FIFO
-  // - RANDOM
-  // - NEVER
   // - LCU -- least commnly used
+  // - GDSF -- greedy dual size frequency (cost is the measured load time)
   // - EAGER
   // - ALL
+  //
+  // victims are selected from eviction_index_, which only tracks models that
+  // are not in use
   bool perform_eviction(const ModelRequest *request, const size_t estimated_model_size, const size_t memory_to_free) {
     static const auto eviction_policy = UPRD_EVICTION_POLICY;
 
@@ -750,30 +1527,19 @@ private:
     LOG(INFO) << "performing " << eviction_policy << " to get " << memory_to_free
               << " of extra memory for the estimated model size " << estimated_model_size;
 
-    if (eviction_policy == "never") {
-      return perform_no_eviction(request, estimated_model_size, memory_to_free);
-    }
-    if (eviction_policy == "lru") {
-      return perform_lru_eviction(request, estimated_model_size, memory_to_free);
-    }
-    if (eviction_policy == "fifo") {
-      return perform_fifo_eviction(request, estimated_model_size, memory_to_free);
-    }
-    if (eviction_policy == "flush" || eviction_policy == "all") {
-      return perform_flush_eviction(request, estimated_model_size, memory_to_free);
-    }
-    if (eviction_policy == "lcu") { // least commnly used
-      return perform_lcu_eviction(request, estimated_model_size, memory_to_free);
+    const auto flush = eviction_policy == "flush" || eviction_policy == "all";
+
+    size_t memory_freed = 0;
+    std::string victim;
+    while ((flush || memory_freed < memory_to_free) && eviction_index_->victim(&victim)) {
+      memory_freed += evict_model(victim);
     }
 
-    const auto msg = fmt::format("the eviction policy {} is not valid", eviction_policy);
-    LOG(ERROR) << msg;
-    throw std::runtime_error(msg);
+    return memory_freed >= memory_to_free;
   }
 
-  bool evict_if_needed(const ModelRequest *request) {
-    static const auto max_memory_to_use = UPRD_MEMORY_PERCENTAGE * memory_total();
-    const auto estimated_model_size     = estimate_model_size(request);
+  bool evict_if_needed(const ModelRequest *request, const size_t estimated_model_size) {
+    static const auto max_memory_to_use = UPRD_MEMORY_PERCENTAGE * backend_memory_total();
     if (estimated_model_size > max_memory_to_use) {
       const auto msg = fmt::format("cannot allocate memory. requsting an estimated {} bytes "
                                    "of memory, while only {} is allocated to be used",
@@ -799,31 +1565,156 @@ private:
   size_t fifo_order{0};
 
 public:
-  // control memory usage by percentage of gpu
-  grpc::Status Open(grpc::ServerContext *context, const ModelRequest *request, ModelHandle *reply) override {
-    const auto model_name = request->name();
+  static bool use_cpu_shared_memory() {
+    static const auto backend = UPRD_MEMORY_BACKEND;
+    if (backend == "cpu") {
+      return true;
+    }
+    if (backend == "cuda") {
+      return false;
+    }
+    throw std::runtime_error(fmt::format("the memory backend {} is not valid", backend));
+  }
 
-    auto span = start_span("open", "grpc", span_props{{"model_name", model_name}});
-    defer(stop_span(span));
+  static size_t backend_memory_total() {
+    if (use_cpu_shared_memory()) {
+      return host_memory_total();
+    }
+    return memory_total();
+  }
 
-    // LOG(INFO) << "opening " << request->name();
+  // maps the cpu copies that a previous run of uprd left in UPRD_CPU_TIER_DIR
+  // back into the cpu tier, so that their models are reloaded from host memory
+  // rather than from disk. the copies of models that changed or are no longer
+  // found, and the ones that no longer fit, are removed
+  void restore_cpu_tier() {
+    if (cpu_tier_files_ == nullptr) {
+      return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    size_t num_restored = 0, restored_byte_count = 0;
+    for (const auto &segment : cpu_tier_files_->restore()) {
+      const auto &index = segment.index;
+      if (index.source_version.empty() || index.source_version != model_source_version(index.model_name)) {
+        LOG(INFO) << "discarding the cpu tier file of " << index.model_name << ", since its params changed";
+        cpu_tier_files_->release(segment.base_ptr);
+        continue;
+      }
+      {
+        std::lock_guard<std::mutex> lock(cpu_persistent_data_mutex_);
+        if (cpu_persistent_data.find(index.model_name) != cpu_persistent_data.end() ||
+            !reserve_on_cpu(index.byte_count)) {
+          cpu_tier_files_->release(segment.base_ptr);
+          continue;
+        }
+      }
+      if (cudaHostRegister(segment.base_ptr, std::max(index.byte_count, size_t{1}), cudaHostRegisterDefault) !=
+          cudaSuccess) {
+        LOG(ERROR) << "unable to pin the cpu tier file of " << index.model_name;
+        cpu_tier_files_->release(segment.base_ptr);
+        unreserve_on_cpu(index.byte_count);
+        continue;
+      }
 
-    auto it = memory_db_.find(model_name);
-    if (it == memory_db_.end()) {
-      const auto uuid = sole::uuid4().str();
+      auto info         = new model_info{};
+      info->granularity = SharingGranularity_Model;
+      info->base_ptr    = segment.base_ptr;
+      info->byte_count  = index.byte_count;
+      for (const auto &layer : index.layers) {
+        info->shapes.emplace_back(TShape(layer.shape.begin(), layer.shape.end()));
+        info->data.emplace_back(((char *) segment.base_ptr) + layer.offset);
+        info->layer_names.emplace_back(layer.name);
+        info->offsets.emplace_back(layer.offset);
+      }
+      publish_on_cpu(index.model_name, info);
+      restored_models_.add();
+      num_restored++;
+      restored_byte_count += index.byte_count;
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LOG(INFO) << "restored " << num_restored << " models (" << restored_byte_count << " bytes) into the cpu tier from "
+              << cpu_tier_files_->directory() << " in " << elapsed << "s";
+  }
+
+  // populates the owned model from disk (or from the cpu persistent data).
+  // this is the expensive part of a cold open and runs without holding the
+  // registry lock. returns the bytes of the layers that share the allocation
+  // of a layer of another resident model
+  size_t load_owned_model(Model *model, const ModelRequest *request) {
+    const auto model_name = request->name();
 
-      cudaStream_t stream;
+    cudaStream_t stream = 0;
+    if (!use_cpu_shared_memory()) {
       CUDA_CHECK_CALL(cudaStreamCreate(&stream), "unable to create stream");
+    }
 
-      auto owned_span = start_span("load_owned", "load", span_props{{"model_name", model_name}});
-      defer(stop_span(owned_span));
+    auto owned_model    = model->mutable_owned_model();
+    size_t shared_bytes = 0;
 
-      bool needed_eviction = false;
-      try {
-        needed_eviction = evict_if_needed(request);
-      } catch (const std::runtime_error &error) {
-        return grpc::Status(grpc::RESOURCE_EXHAUSTED, error.what());
+    if (use_cpu_shared_memory()) {
+      load_ndarray_to_shared_memory(owned_model, request);
+    } else {
+      load_ndarray(owned_model->mutable_layer(), request, /*ref_count=*/-1, stream, &shared_bytes);
+    }
+
+    int64_t byte_count = 0;
+    const auto layers  = owned_model->layer();
+    for (const auto it : layers) {
+      byte_count += it.byte_count();
+    }
+
+    owned_model->set_byte_count(byte_count);
+
+    if (use_cpu_shared_memory()) {
+      // the shared memory segment always holds the whole model
+      owned_model->set_sharing_granularity(SharingGranularity_Model);
+    } else if (request->sharing_granularity() == SharingGranularity_Model) {
+      owned_model->set_sharing_granularity(request->sharing_granularity());
+      const auto first_layer = layers.begin();
+      if (first_layer == layers.end()) {
+        throw std::runtime_error("no layers found");
       }
+      owned_model->set_device_raw_ptr(first_layer->device_raw_ptr());
+      owned_model->set_ipc_handle(first_layer->ipc_handle());
+    } else {
+      owned_model->set_sharing_granularity(request->sharing_granularity());
+      owned_model->set_device_raw_ptr(0);
+      owned_model->set_ipc_handle("");
+    }
+
+    if (!use_cpu_shared_memory()) {
+      CUDA_CHECK_CALL(cudaStreamSynchronize(stream), "failed to synchronize stream");
+      CUDA_CHECK_CALL(cudaStreamDestroy(stream), "failed to destroy stream");
+    }
+    return shared_bytes;
+  }
+
+  // loads a cold model into the registry. the load is published in loading_
+  // so that concurrent opens of the same model wait on it instead of reading
+  // the model from disk again. expects the registry lock to be held on entry,
+  // releases it while reading from disk, and holds it again on return
+  grpc::Status load_model(const ModelRequest *request, const graph_memory_estimate &estimate,
+                          std::unique_lock<std::shared_timed_mutex> *lock) {
+    const auto model_name = request->name();
+
+    std::promise<grpc::Status> loaded;
+    loading_.insert({model_name, loaded.get_future().share()});
+
+    auto owned_span = start_span("load_owned", "load", span_props{{"model_name", model_name}});
+    defer(stop_span(owned_span));
+
+    size_t estimated_model_size = 0;
+    bool needed_eviction        = false;
+    auto status                 = grpc::Status::OK;
+    try {
+      estimated_model_size = estimate_model_size(request, estimate);
+      needed_eviction      = evict_if_needed(request, estimated_model_size);
+    } catch (const std::runtime_error &error) {
+      status = grpc::Status(grpc::RESOURCE_EXHAUSTED, error.what());
+    }
+
+    if (status.ok()) {
+      const auto uuid = sole::uuid4().str();
 
       Model *model = new Model();
       model->set_id(uuid);
@@ -837,67 +1728,255 @@ public:
       owned_model->set_name(model_name);
       owned_model->set_needed_eviction(needed_eviction);
 
-      load_ndarray(owned_model->mutable_layer(), request, /*ref_count=*/-1, stream);
+      // reserve the estimated memory while loading, so that concurrent loads
+      // of other models account for it when deciding what to evict
+      memory_usage_ += estimated_model_size;
 
-      int64_t byte_count = 0;
-      const auto layers  = owned_model->layer();
-      for (const auto it : layers) {
-        byte_count += it.byte_count();
+      lock->unlock();
+      const auto load_start = std::chrono::steady_clock::now();
+      size_t shared_bytes   = 0;
+      try {
+        // the evicted models are accounted as freed, but their device memory
+        // may still be in use by their demotions
+        wait_for_device_frees();
+        shared_bytes = load_owned_model(model, request);
+      } catch (const std::exception &error) {
+        LOG(ERROR) << "failed to load " << model_name << ". " << error.what();
+        status = grpc::Status(grpc::INTERNAL, error.what());
       }
-
-      owned_model->set_byte_count(byte_count);
-      owned_model->set_sharing_granularity(request->sharing_granularity());
-
-      if (request->sharing_granularity() == SharingGranularity_Model) {
-        const auto first_layer = layers.begin();
-        if (first_layer == layers.end()) {
-          throw std::runtime_error("no layers found");
+      const auto load_duration =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - load_start);
+      model->set_load_duration(load_duration.count());
+      loads_.add();
+      load_latency_.record(load_duration);
+      lock->lock();
+
+      memory_usage_ -= estimated_model_size;
+
+      if (status.ok()) {
+        model->set_fifo_order(fifo_order++);
+        memory_db_.insert({model_name, model});
+        auto &resident      = resident_[model->id()];
+        resident.model_name = model_name;
+        from_owned_modelhandle(&resident.open_reply, model->owned_model(), /*ref_count=*/0);
+        // only the layers that are not shared with a resident model use memory
+        memory_usage_ += model->owned_model().byte_count() - shared_bytes;
+        if (shared_bytes != 0) {
+          LOG(INFO) << fmt::format("{} shares {} of its {} bytes with the resident models", model_name, shared_bytes,
+                                   model->owned_model().byte_count());
         }
-        owned_model->set_device_raw_ptr(first_layer->device_raw_ptr());
-        owned_model->set_ipc_handle(first_layer->ipc_handle());
+        refine_memory_estimate(model);
+        eviction_index_->insert(model_name, model->owned_model().byte_count(), model->load_duration());
       } else {
-        owned_model->set_device_raw_ptr(0);
-        owned_model->set_ipc_handle("");
+        delete model;
       }
+    }
 
-      model->set_fifo_order(fifo_order++);
-
-      memory_db_.insert({model_name, model});
-      memory_usage_ += byte_count;
+    if (!status.ok()) {
+      load_failures_.add();
+    }
+    loading_.erase(model_name);
+    loaded.set_value(status);
+    return status;
+  }
 
-      CUDA_CHECK_CALL(cudaStreamSynchronize(stream), "failed to synchronize stream");
-      CUDA_CHECK_CALL(cudaStreamDestroy(stream), "failed to destroy stream");
+  grpc::Status check_memory_backend(const ModelRequest *request) const {
+    const auto expected_backend = use_cpu_shared_memory() ? MemoryBackend_CPUShared : MemoryBackend_CUDA;
+    if (request->memory_backend() != expected_backend) {
+      return grpc::Status(grpc::INVALID_ARGUMENT,
+                          fmt::format("requested the {} memory backend while the server uses the {} memory backend",
+                                      MemoryBackend_Name(request->memory_backend()),
+                                      MemoryBackend_Name(expected_backend)));
     }
+    return grpc::Status::OK;
+  }
 
-    auto shared_span = start_span("make_shared", "share", span_props{{"model_name", model_name}});
+  // creates a shared handle to a resident model from its precomputed reply.
+  // the handle is leased if the request has a client id. expects the registry
+  // lock to be held
+  void open_resident(Model *model, const ModelRequest *request, ModelHandle *reply) {
+    auto shared_span = start_span("make_shared", "share", span_props{{"model_name", model->name()}});
     defer(stop_span(shared_span));
 
-    // LOG(INFO) << "done with creating owned model";
+    auto &resident    = resident_.at(model->id());
+    const auto handle = resident.next_handle++;
+    resident.open_handles.insert(handle);
 
-    it = memory_db_.find(model_name);
-    CHECK(it != memory_db_.end()) << "expecting the model to be there";
+    model->set_ref_count(model->ref_count() + 1);
+    eviction_index_->acquire(model->name());
 
-    auto model = it->second;
-    CHECK(model != nullptr) << "expecting a valid model";
+    auto t = model->mutable_lru_timestamp();
+    t->CopyFrom(TimeUtil::GetCurrentTime());
 
-    // now we need to use the owned array to create
-    // new memory handles
-    // LOG(INFO) << "creating shared handle from owned memory";
-    model->set_ref_count(model->ref_count() + 1);
-    auto handle = model->mutable_shared_model()->Add();
-    from_owned_modelhandle(handle, model->owned_model(), model->ref_count());
-    // LOG(INFO) << "sending " << model->owned_model().layer().size() << "
-    // layers to client";
+    reply->CopyFrom(resident.open_reply);
+    reply->set_id(make_handle_id(model->id(), handle));
 
-    // LOG(INFO) << "finished satisfying open request";
+    if (UPRD_LEASE_TTL_MS > 0 && !request->client_id().empty()) {
+      leases_.add(leased_handle{request->client_id(), model->id(), reply->id()});
+      reply->set_lease_ttl(UPRD_LEASE_TTL_MS);
+    }
+  }
 
-    auto h = model->mutable_use_history()->Add();
-    h->CopyFrom(TimeUtil::GetCurrentTime());
+  static bool wants_prepared_graph(const ModelRequest *request) {
+    return UPRD_PREPARED_GRAPHS && request->input_shape().dim_size() != 0;
+  }
 
-    auto t = model->mutable_lru_timestamp();
-    t->CopyFrom(TimeUtil::GetCurrentTime());
+  static std::string prepared_graph_key(const ModelRequest *request) {
+    std::string key = request->name() + ":" + request->input_name();
+    for (const auto dim : request->input_shape().dim()) {
+      key += fmt::format(":{}", dim);
+    }
+    return key;
+  }
+
+  // returns false if the graph requested has not been prepared yet
+  bool find_prepared_graph(const ModelRequest *request, std::string *graph_json) {
+    std::lock_guard<std::mutex> lock(prepared_graphs_mutex_);
+    auto it = prepared_graphs_.find(prepared_graph_key(request));
+    if (it == prepared_graphs_.end()) {
+      return false;
+    }
+    *graph_json = it->second;
+    return true;
+  }
 
-    reply->CopyFrom(*handle);
+  // prepares the graph requested, unless it is cached. the symbol is read and
+  // the shapes are inferred without holding any lock
+  grpc::Status get_prepared_graph(const ModelRequest *request, std::string *graph_json) {
+    if (find_prepared_graph(request, graph_json)) {
+      return grpc::Status::OK;
+    }
+    const auto model_name = request->name();
+    auto span             = start_span("prepare_graph", "load", span_props{{"model_name", model_name}});
+    defer(stop_span(span));
+
+    const auto &dims = request->input_shape().dim();
+    try {
+      const auto symbol_path = get_model_symbol_path(model_name);
+      std::ifstream in(symbol_path);
+      if (!in.is_open()) {
+        throw std::runtime_error(fmt::format("unable to open {}", symbol_path));
+      }
+      const std::string symbol_json((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+      *graph_json = prepare_graph_json(symbol_json, request->input_name(), mxnet::TShape(dims.begin(), dims.end()));
+    } catch (const std::exception &error) {
+      const auto msg = fmt::format("unable to prepare the graph of {}. {}", model_name, error.what());
+      LOG(ERROR) << msg;
+      return grpc::Status(grpc::INVALID_ARGUMENT, msg);
+    }
+
+    std::lock_guard<std::mutex> lock(prepared_graphs_mutex_);
+    prepared_graphs_.emplace(prepared_graph_key(request), *graph_json);
+    return grpc::Status::OK;
+  }
+
+  // serves an open without blocking on disk. returns false if the model is not
+  // resident (or its prepared graph is requested and not cached), in which
+  // case the request has to go through timed_open. start is when the request was
+  // accepted, so the recorded latency includes the time spent queued
+  bool TryOpen(const ModelRequest *request, ModelHandle *reply, grpc::Status *status,
+               std::chrono::steady_clock::time_point start) {
+    *status = check_memory_backend(request);
+    if (!status->ok()) {
+      record_open(start, *status);
+      return true;
+    }
+    std::string graph_json{};
+    if (wants_prepared_graph(request) && !find_prepared_graph(request, &graph_json)) {
+      return false;
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(registry_mutex_);
+
+    auto it = memory_db_.find(request->name());
+    if (it == memory_db_.end()) {
+      return false;
+    }
+    open_resident(it->second, request, reply);
+    reply->set_graph_json(graph_json);
+    open_hits_.add();
+    record_open(start, *status);
+    return true;
+  }
+
+  grpc::Status Open(grpc::ServerContext *context, const ModelRequest *request, ModelHandle *reply) override {
+    return timed_open(request, reply, std::chrono::steady_clock::now());
+  }
+
+  // opens the model and records the latency since start, when the request was accepted
+  grpc::Status timed_open(const ModelRequest *request, ModelHandle *reply,
+                          std::chrono::steady_clock::time_point start) {
+    const auto status = open_model(request, reply);
+    record_open(start, status);
+    return status;
+  }
+
+  // control memory usage by percentage of gpu
+  grpc::Status open_model(const ModelRequest *request, ModelHandle *reply) {
+    const auto model_name = request->name();
+
+    auto span = start_span("open", "grpc", span_props{{"model_name", model_name}});
+    defer(stop_span(span));
+
+    // LOG(INFO) << "opening " << request->name();
+
+    const auto backend_status = check_memory_backend(request);
+    if (!backend_status.ok()) {
+      return backend_status;
+    }
+    // prepared before the model is opened, so a failure does not leak a handle
+    std::string graph_json{};
+    if (wants_prepared_graph(request)) {
+      const auto graph_status = get_prepared_graph(request, &graph_json);
+      if (!graph_status.ok()) {
+        return graph_status;
+      }
+    }
+    // estimated before taking the registry lock, since estimating a model seen
+    // for the first time reads its symbol and infers its shapes. only used if
+    // the model has to be loaded
+    graph_memory_estimate estimate{};
+    auto estimate_status = grpc::Status::OK;
+    try {
+      estimate = get_memory_estimate(model_name);
+    } catch (const std::runtime_error &error) {
+      estimate_status = grpc::Status(grpc::RESOURCE_EXHAUSTED, error.what());
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(registry_mutex_);
+
+    // this is a loop, since the model can get evicted between the time a
+    // concurrent load finishes and the time this request reacquires the lock
+    auto it = memory_db_.find(model_name);
+    if (it == memory_db_.end()) {
+      open_misses_.add();
+    } else {
+      open_hits_.add();
+    }
+    while (it == memory_db_.end()) {
+      auto status   = grpc::Status::OK;
+      auto inflight = loading_.find(model_name);
+      if (inflight != loading_.end()) {
+        auto pending = inflight->second;
+        lock.unlock();
+        status = pending.get();
+        lock.lock();
+      } else if (!estimate_status.ok()) {
+        status = estimate_status;
+      } else {
+        status = load_model(request, estimate, &lock);
+      }
+      if (!status.ok()) {
+        return status;
+      }
+      it = memory_db_.find(model_name);
+    }
+
+    auto model = it->second;
+    CHECK(model != nullptr) << "expecting a valid model";
+
+    open_resident(model, request, reply);
+    reply->set_graph_json(graph_json);
 
     return grpc::Status::OK;
   }
@@ -907,6 +1986,8 @@ public:
     auto span = start_span("info", "grpc", span_props{{"model_name", request->name()}});
     defer(stop_span(span));
 
+    std::shared_lock<std::shared_timed_mutex> lock(registry_mutex_);
+
     auto it = memory_db_.find(request->name());
     if (it == memory_db_.end()) {
       LOG(ERROR) << "failed to info request. cannot find " << request->name() << " in cache. "
@@ -920,70 +2001,187 @@ public:
     return grpc::Status::OK;
   }
 
-  std::string find_model_name_by_model_id(std::string model_id) {
-    for (const auto &kv : memory_db_) {
-      const auto &k = kv.first;
-      const auto &v = kv.second;
-      if (v->id() == model_id) {
-        return k;
-      }
-    }
-    return "";
-  }
-
-  void destroy_model_handle(const ModelHandle &handle) {
-  }
-
   grpc::Status Close(grpc::ServerContext *context, const ModelHandle *request, Void *reply) override {
 
     auto span = start_span("close", "grpc", span_props{{"id", request->id()}, {"model_id", request->model_id()}});
     defer(stop_span(span));
 
-    const auto model_name = find_model_name_by_model_id(request->model_id());
-    if (model_name == "") {
-      LOG(ERROR) << "failed to close request.  unable to find model name with id " << request->model_id()
+    latency_timer timer(&close_latency_);
+    closes_.add();
+
+    std::unique_lock<std::shared_timed_mutex> lock(registry_mutex_);
+    return close_handle(request->model_id(), request->id());
+  }
+
+  grpc::Status Heartbeat(grpc::ServerContext *context, const Lease *request, Lease *reply) override {
+    if (!leases_.renew(request->client_id())) {
+      return grpc::Status(grpc::NOT_FOUND, fmt::format("the client {} holds no lease. either it has no open handle, "
+                                                       "or its lease expired and its handles were closed",
+                                                       request->client_id()));
+    }
+    reply->set_client_id(request->client_id());
+    reply->set_ttl(UPRD_LEASE_TTL_MS);
+    return grpc::Status::OK;
+  }
+
+  // closes the handles of the clients whose lease expired. the handles that
+  // were closed by their client in the meantime are skipped
+  void reclaim_handles(const std::vector<leased_handle> &handles) {
+    std::unique_lock<std::shared_timed_mutex> lock(registry_mutex_);
+    for (const auto &handle : handles) {
+      if (close_handle(handle.model_id, handle.handle_id).ok()) {
+        LOG(INFO) << "closed the handle " << handle.handle_id << " of the client " << handle.client_id
+                  << ", since its lease expired";
+        reclaimed_handles_.add();
+      }
+    }
+  }
+
+  // expects the registry lock to be held
+  grpc::Status close_handle(const std::string &model_id, const std::string &handle_id) {
+    auto resident_entry = resident_.find(model_id);
+    if (resident_entry == resident_.end()) {
+      LOG(ERROR) << "failed to close request.  unable to find model name with id " << model_id
                  << " during close request";
       return grpc::Status(grpc::NOT_FOUND,
-                          std::string("unable to find model name with id ") + request->model_id() +
-                              " during close request");
+                          std::string("unable to find model name with id ") + model_id + " during close request");
     }
-    auto model_entry = memory_db_.find(model_name);
-    if (model_entry == memory_db_.end()) {
-      LOG(ERROR) << "failed to close request\n";
+    auto &resident        = resident_entry->second;
+    const auto model_name = resident.model_name;
+
+    uint64_t handle = 0;
+    if (!parse_handle_id(handle_id, model_id, &handle) || resident.open_handles.erase(handle) == 0) {
       return grpc::Status(grpc::NOT_FOUND,
-                          std::string("unable to find handle with name ") + model_name + " during close request");
+                          std::string("the handle ") + handle_id + " of the model " + model_name +
+                              " is not open during close request");
     }
+    leases_.remove(handle_id);
 
-    auto model              = model_entry->second;
-    const auto handle_id    = request->id();
-    const auto shared_model = model->mutable_shared_model();
-    for (auto it = shared_model->begin(); it != shared_model->end(); it++) {
-      auto shared_model_handle = *it;
-      if (shared_model_handle.id() != handle_id) {
-        continue;
-      }
-      destroy_model_handle(shared_model_handle);
-      model->mutable_shared_model()->erase(it);
-      break;
-    }
+    auto model = memory_db_.at(model_name);
 
     const auto ref_count = model->ref_count() - 1;
     model->set_ref_count(ref_count);
+    eviction_index_->release(model_name);
 
     if (ref_count == 0) {
       static const auto eviction_policy = UPRD_EVICTION_POLICY;
       if (eviction_policy == "eager" || UPRD_PERSIST_ONLY_CPU) {
-        const auto byte_count = model->owned_model().byte_count();
-        memory_usage_ -= byte_count;
-        model_delete(model);
-        memory_db_.erase(model_entry);
+        evict_model(model_name);
       }
     }
 
     return grpc::Status::OK;
   }
 
+  grpc::Status Stats(grpc::ServerContext *context, const Void *request, RegistryStats *reply) override {
+    auto span = start_span("stats", "grpc");
+    defer(stop_span(span));
+
+    reply->mutable_timestamp()->CopyFrom(TimeUtil::GetCurrentTime());
+    reply->set_uptime(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started_at_).count());
+    metrics_.for_each_counter([reply](const std::string &name, const upr::counter &value) {
+      auto counter = reply->add_counter();
+      counter->set_name(name);
+      counter->set_value(value.value());
+    });
+    metrics_.for_each_histogram([reply](const std::string &name, const latency_histogram &value) {
+      auto histogram = reply->add_histogram();
+      histogram->set_name(name);
+      histogram->set_count(value.count());
+      histogram->set_sum(value.sum());
+      histogram->set_max(value.max());
+      histogram->set_p50(value.percentile(0.5));
+      histogram->set_p90(value.percentile(0.9));
+      histogram->set_p99(value.percentile(0.99));
+      for (const auto &bucket : value.buckets()) {
+        histogram->add_bucket_upper_bound(bucket.upper_bound);
+        histogram->add_bucket_count(bucket.count);
+      }
+    });
+    snapshot_tiers(reply);
+
+    return grpc::Status::OK;
+  }
+
+  // the metrics and the occupancy of the tiers in the prometheus text format
+  std::string metrics_text() {
+    prometheus_writer writer;
+    metrics_.write(&writer);
+
+    RegistryStats stats;
+    snapshot_tiers(&stats);
+    for (const auto &tier : stats.tier()) {
+      const prometheus_writer::labels labels{{"tier", tier.name()}};
+      writer.gauge("uprd_tier_bytes", "bytes held by the tier", tier.byte_count(), labels);
+      writer.gauge("uprd_tier_capacity_bytes", "bytes the tier may use", tier.capacity(), labels);
+      writer.gauge("uprd_tier_models", "models held by the tier", tier.num_models(), labels);
+    }
+    writer.gauge("uprd_leases", "clients holding a lease", leases_.size());
+    writer.gauge("uprd_leased_handles", "handles opened under a lease", leases_.num_handles());
+    for (const auto &model : stats.model()) {
+      writer.gauge("uprd_model_bytes", "bytes of the model held by the tier", model.byte_count(),
+                   {{"model", model.name()}, {"tier", model.tier()}});
+    }
+    for (const auto &model : stats.model()) {
+      if (model.tier() == device_tier_name()) {
+        writer.gauge("uprd_model_open_handles", "open handles of the resident model", model.ref_count(),
+                     {{"model", model.name()}});
+      }
+    }
+    return writer.str();
+  }
+
 private:
+  static std::string device_tier_name() {
+    return use_cpu_shared_memory() ? "shared_memory" : "gpu";
+  }
+
+  void record_open(std::chrono::steady_clock::time_point start, const grpc::Status &status) {
+    opens_.add();
+    if (!status.ok()) {
+      open_failures_.add();
+    }
+    open_latency_.record(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+  }
+
+  // adds the occupancy of the device and the cpu tier. the tiers are locked
+  // one after the other, so a model moving between them may be missed. the
+  // device bytes include the reservations of the loads in flight
+  void snapshot_tiers(RegistryStats *reply) {
+    {
+      static const auto max_memory_to_use = UPRD_MEMORY_PERCENTAGE * backend_memory_total();
+      std::shared_lock<std::shared_timed_mutex> lock(registry_mutex_);
+      auto tier = reply->add_tier();
+      tier->set_name(device_tier_name());
+      tier->set_byte_count(memory_usage_);
+      tier->set_capacity(max_memory_to_use);
+      tier->set_num_models(memory_db_.size());
+      for (const auto &entry : memory_db_) {
+        const auto model = entry.second;
+        auto stats       = reply->add_model();
+        stats->set_name(model->name());
+        stats->set_tier(tier->name());
+        stats->set_byte_count(model->owned_model().byte_count());
+        stats->set_ref_count(model->ref_count());
+        stats->set_load_duration(model->load_duration());
+      }
+    }
+    std::lock_guard<std::mutex> lock(cpu_persistent_data_mutex_);
+    auto tier = reply->add_tier();
+    tier->set_name("cpu");
+    tier->set_byte_count(cpu_memory_usage_);
+    tier->set_capacity(cpu_memory_limit());
+    tier->set_num_models(cpu_persistent_data.size());
+    for (const auto &entry : cpu_persistent_data) {
+      auto stats = reply->add_model();
+      stats->set_name(entry.first);
+      stats->set_tier(tier->name());
+      stats->set_byte_count(entry.second->byte_count);
+    }
+  }
+
   std::string nextSuffix() {
     static std::random_device rand;
     std::mt19937 gen(rand());
@@ -993,8 +2191,229 @@ private:
 
   // The actual database.
 
+  // the registry is served from the completion queue threads and the load
+  // workers (or the grpc thread pool when UPRD_ASYNC_SERVER=false). the lock guards
+  // memory_db_, memory_usage_, fifo_order, loading_ and the models in
+  // memory_db_. it is not held while models are read from disk
+  std::shared_timed_mutex registry_mutex_;
   memory_db_t memory_db_;
   int64_t memory_usage_{0};
+  // eviction candidates among the models in memory_db_
+  std::unique_ptr<eviction_index> eviction_index_{make_eviction_index(UPRD_EVICTION_POLICY)};
+  // the memory estimates keyed by model name and input shape. guarded by
+  // memory_estimates_mutex_ rather than the registry lock
+  std::mutex memory_estimates_mutex_;
+  std::unordered_map<std::string, graph_memory_estimate> memory_estimates_{};
+  // keyed by model id. holds an entry for every model in memory_db_
+  std::unordered_map<std::string, resident_model> resident_{};
+  // the prepared graphs keyed by model name, input name and input shape.
+  // guarded by prepared_graphs_mutex_ rather than the registry lock
+  std::mutex prepared_graphs_mutex_;
+  std::unordered_map<std::string, std::string> prepared_graphs_{};
+  // cold models that are currently being loaded
+  std::unordered_map<std::string, std::shared_future<grpc::Status>> loading_{};
+  // the leases of the handles opened with a client id. guarded by its own
+  // lock, which is taken after the registry lock
+  lease_table leases_{std::chrono::milliseconds(UPRD_LEASE_TTL_MS)};
+  // the evicted models whose demotion is pending, and so whose device memory
+  // is not freed yet
+  std::mutex demotions_mutex_;
+  std::condition_variable device_memory_freed_;
+  size_t device_frees_pending_{0};
+  // declared after the members the demotions use, so that the pending ones
+  // finish before these are destroyed
+  worker_pool demotion_worker_{1};
+  // declared last, so that it stops before the members it uses are destroyed
+  std::unique_ptr<lease_reaper> lease_reaper_{
+      UPRD_LEASE_TTL_MS > 0
+          ? new lease_reaper(&leases_, [this](const std::vector<leased_handle> &expired) { reclaim_handles(expired); })
+          : nullptr};
+};
+
+// serves the registry using the grpc completion queue api.
+//
+// Info, Close, Stats, Heartbeat and opens of resident models only hold the
+// registry lock for a short time, so they are served directly on the completion queue threads.
+// opens of cold models are handed to the load worker pool, which answers them
+// once the model is loaded. this way cache hits never queue behind cold loads
+class AsyncRegistryServer {
+public:
+  AsyncRegistryServer(RegistryImpl *registry, int num_load_workers)
+      : registry_(registry), load_workers_(num_load_workers) {
+  }
+
+  void Run(ServerBuilder *builder, int num_threads) {
+    builder->RegisterService(&service_);
+    cq_     = builder->AddCompletionQueue();
+    server_ = builder->BuildAndStart();
+
+    new OpenCall(this);
+    new InfoCall(this);
+    new CloseCall(this);
+    new StatsCall(this);
+    new HeartbeatCall(this);
+
+    for (int ii = 0; ii < std::max(num_threads, 1); ii++) {
+      threads_.emplace_back([this]() { poll(); });
+    }
+  }
+
+  void Shutdown() {
+    server_->Shutdown();
+    // the pending loads still reply through the completion queue
+    load_workers_.stop();
+    cq_->Shutdown();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+private:
+  class Call {
+  public:
+    virtual ~Call() = default;
+    // invoked when the completion queue returns the call's tag
+    virtual void Proceed(bool ok) = 0;
+  };
+
+  // the state machine shared by the unary calls. a call is first requested
+  // from the server, then processed once a request arrives, and deleted
+  // once the reply is sent
+  template <typename Request, typename Reply>
+  class UnaryCall : public Call {
+  public:
+    explicit UnaryCall(AsyncRegistryServer *server) : server_(server), responder_(&context_) {
+    }
+
+    void Proceed(bool ok) override {
+      if (!ok || state_ == state::finish) {
+        delete this;
+        return;
+      }
+      state_       = state::finish;
+      accepted_at_ = std::chrono::steady_clock::now();
+      // start accepting the next request before processing this one
+      Clone();
+      Process();
+    }
+
+  protected:
+    enum class state { request, finish };
+
+    virtual void Clone()   = 0;
+    virtual void Process() = 0;
+
+    void Finish(const grpc::Status &status) {
+      responder_.Finish(reply_, status, this);
+    }
+
+    AsyncRegistryServer *server_;
+    grpc::ServerContext context_;
+    Request request_;
+    Reply reply_;
+    grpc::ServerAsyncResponseWriter<Reply> responder_;
+    state state_{state::request};
+    // when the completion queue returned the request
+    std::chrono::steady_clock::time_point accepted_at_;
+  };
+
+  class OpenCall final : public UnaryCall<ModelRequest, ModelHandle> {
+  public:
+    explicit OpenCall(AsyncRegistryServer *server) : UnaryCall(server) {
+      server_->service_.RequestOpen(&context_, &request_, &responder_, server_->cq_.get(), server_->cq_.get(), this);
+    }
+
+  protected:
+    void Clone() override {
+      new OpenCall(server_);
+    }
+    void Process() override {
+      grpc::Status status;
+      if (server_->registry_->TryOpen(&request_, &reply_, &status, accepted_at_)) {
+        Finish(status);
+        return;
+      }
+      // the latency is measured from the acceptance, so the wait for a load worker is included
+      server_->load_workers_.submit(
+          [this]() { Finish(server_->registry_->timed_open(&request_, &reply_, accepted_at_)); });
+    }
+  };
+
+  class InfoCall final : public UnaryCall<ModelRequest, Model> {
+  public:
+    explicit InfoCall(AsyncRegistryServer *server) : UnaryCall(server) {
+      server_->service_.RequestInfo(&context_, &request_, &responder_, server_->cq_.get(), server_->cq_.get(), this);
+    }
+
+  protected:
+    void Clone() override {
+      new InfoCall(server_);
+    }
+    void Process() override {
+      Finish(server_->registry_->Info(&context_, &request_, &reply_));
+    }
+  };
+
+  class CloseCall final : public UnaryCall<ModelHandle, Void> {
+  public:
+    explicit CloseCall(AsyncRegistryServer *server) : UnaryCall(server) {
+      server_->service_.RequestClose(&context_, &request_, &responder_, server_->cq_.get(), server_->cq_.get(), this);
+    }
+
+  protected:
+    void Clone() override {
+      new CloseCall(server_);
+    }
+    void Process() override {
+      Finish(server_->registry_->Close(&context_, &request_, &reply_));
+    }
+  };
+
+  class StatsCall final : public UnaryCall<Void, RegistryStats> {
+  public:
+    explicit StatsCall(AsyncRegistryServer *server) : UnaryCall(server) {
+      server_->service_.RequestStats(&context_, &request_, &responder_, server_->cq_.get(), server_->cq_.get(), this);
+    }
+
+  protected:
+    void Clone() override {
+      new StatsCall(server_);
+    }
+    void Process() override {
+      Finish(server_->registry_->Stats(&context_, &request_, &reply_));
+    }
+  };
+
+  class HeartbeatCall final : public UnaryCall<Lease, Lease> {
+  public:
+    explicit HeartbeatCall(AsyncRegistryServer *server) : UnaryCall(server) {
+      server_->service_.RequestHeartbeat(&context_, &request_, &responder_, server_->cq_.get(), server_->cq_.get(),
+                                         this);
+    }
+
+  protected:
+    void Clone() override {
+      new HeartbeatCall(server_);
+    }
+    void Process() override {
+      Finish(server_->registry_->Heartbeat(&context_, &request_, &reply_));
+    }
+  };
+
+  void poll() {
+    void *tag = nullptr;
+    bool ok   = false;
+    while (cq_->Next(&tag, &ok)) {
+      static_cast<Call *>(tag)->Proceed(ok);
+    }
+  }
+
+  RegistryImpl *registry_;
+  Registry::AsyncService service_{};
+  std::unique_ptr<ServerCompletionQueue> cq_{nullptr};
+  std::unique_ptr<Server> server_{nullptr};
+  std::vector<std::thread> threads_{};
+  worker_pool load_workers_;
 };
 
 std::promise<void> exit_requested;
@@ -1002,7 +2421,7 @@ std::promise<void> exit_requested;
 int main(int argc, const char *argv[]) {
   static const auto eviction_policy   = UPRD_EVICTION_POLICY;
   static const auto estimation_rate   = UPRD_ESTIMATION_RATE;
-  static const auto max_memory_to_use = UPRD_MEMORY_PERCENTAGE * memory_total();
+  static const auto max_memory_to_use = UPRD_MEMORY_PERCENTAGE * RegistryImpl::backend_memory_total();
   int version                         = 0;
   const auto err                      = MXGetVersion(&version);
   if (err) {
@@ -1014,12 +2433,25 @@ int main(int argc, const char *argv[]) {
   LOG(INFO) << "in uprd. using mxnet version = " << version << " running on address  = " << server::address << "\n";
   LOG(INFO) << "eviction_policy = " << eviction_policy << "\n"
             << "estimation_rate = " << estimation_rate << "\n"
+            << "memory_backend = " << UPRD_MEMORY_BACKEND << "\n"
             << "max_memory_to_use = " << max_memory_to_use;
   if (UPRD_WRITE_PROFILE) {
     LOG(INFO) << "profile_path = " << profile_path;
   }
 
-  force_runtime_initialization();
+  if (!RegistryImpl::use_cpu_shared_memory()) {
+    force_runtime_initialization();
+  }
+
+  auto &catalog = get_model_catalog();
+  catalog.scan(UPR_BASE_DIR);
+  if (UPRD_MODEL_MANIFEST != "") {
+    catalog.load_manifest(UPRD_MODEL_MANIFEST);
+  }
+  if (UPRD_WATCH_MODELS) {
+    catalog.watch();
+  }
+  LOG(INFO) << "found " << catalog.size() << " models in " << UPR_BASE_DIR;
 
   MXPredInit();
 
@@ -1030,22 +2462,50 @@ int main(int argc, const char *argv[]) {
 
   std::string server_address(server::address);
   RegistryImpl service;
+  service.restore_cpu_tier();
 
   ServerBuilder builder;
   // Listen on the given address without any authentication mechanism.
   builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-  // Register "service" as the instance through which we'll communicate with
-  // clients. In this case it corresponds to an *synchronous* service.
-  builder.RegisterService(&service);
-  // Finally assemble the server.
-  std::unique_ptr<Server> server(builder.BuildAndStart());
-  std::cout << "Server listening on " << server_address << std::endl;
+  // local clients connect through the unix domain socket, which avoids the tcp
+  // loopback. the tcp address is kept for clients that do not set
+  // UPR_SOCKET_PATH
+  if (!server::socket_path.empty()) {
+    // remove the socket left behind by a previous run
+    unlink(server::socket_path.c_str());
+    builder.AddListeningPort(server::local_address, grpc::InsecureServerCredentials());
+  }
 
-  // Wait for the server to shutdown. Note that some other thread must be
-  // responsible for shutting down the server for this call to ever return.
-  auto serveFn = [&]() { server->Wait(); };
+  std::unique_ptr<AsyncRegistryServer> async_server{nullptr};
+  std::unique_ptr<Server> server{nullptr};
+  std::thread serving_thread;
+  if (UPRD_ASYNC_SERVER) {
+    async_server.reset(new AsyncRegistryServer(&service, UPRD_LOAD_WORKERS));
+    async_server->Run(&builder, UPRD_COMPLETION_QUEUE_THREADS);
+    LOG(INFO) << "serving with " << UPRD_COMPLETION_QUEUE_THREADS << " completion queue threads and "
+              << UPRD_LOAD_WORKERS << " load workers";
+  } else {
+    // Register "service" as the instance through which we'll communicate with
+    // clients. In this case it corresponds to an *synchronous* service.
+    builder.RegisterService(&service);
+    // Finally assemble the server.
+    server = builder.BuildAndStart();
+    // Wait for the server to shutdown. Note that some other thread must be
+    // responsible for shutting down the server for this call to ever return.
+    serving_thread = std::thread([&]() { server->Wait(); });
+  }
+  std::cout << "Server listening on " << server_address << std::endl;
 
-  std::thread serving_thread(serveFn);
+  std::unique_ptr<metrics_file_exporter> metrics_exporter{nullptr};
+  if (!UPRD_METRICS_FILE.empty()) {
+    metrics_exporter.reset(new metrics_file_exporter(UPRD_METRICS_FILE,
+                                                     std::chrono::milliseconds(UPRD_METRICS_INTERVAL_MS),
+                                                     [&service]() { return service.metrics_text(); }));
+    LOG(INFO) << "writing the metrics to " << UPRD_METRICS_FILE << " every " << UPRD_METRICS_INTERVAL_MS << "ms";
+  }
+  if (!server::socket_path.empty()) {
+    std::cout << "Server listening on " << server::local_address << std::endl;
+  }
 
   auto signal_handler = [](int s) { exit_requested.set_value(); };
   std::signal(SIGINT, signal_handler);
@@ -1057,8 +2517,19 @@ int main(int argc, const char *argv[]) {
 
   MXSetProfilerState(0);
 
-  server->Shutdown();
-  serving_thread.join();
+  // writes the final metrics before the registry goes away
+  metrics_exporter.reset();
+
+  if (async_server != nullptr) {
+    async_server->Shutdown();
+  } else {
+    server->Shutdown();
+    serving_thread.join();
+  }
+
+  if (!server::socket_path.empty()) {
+    unlink(server::socket_path.c_str());
+  }
 
   return 0;
 }
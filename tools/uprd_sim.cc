@@ -0,0 +1,347 @@
+// Trace driven simulator for the uprd caching policies.
+//
+// Replays a request trace against the registry eviction logic with a fake
+// memory backend, and reports the hit rate, the number of bytes loaded and the
+// open latency percentiles for every policy. This allows one to tune
+// UPRD_EVICTION_POLICY and UPRD_MEMORY_PERCENTAGE offline. A failed open never
+// serves the model, so it counts as an infinite latency in the percentiles: a
+// policy failing more than 1% of the opens reports an infinite p99.
+//
+// usage: uprd_sim <trace_file> <model_file>
+//
+// trace_file has one request per line
+//   timestamp_ms,model_name,hold_ms
+// where hold_ms is the time between the open and the close of the handle.
+//
+// model_file has one model per line
+//   model_name,byte_count[,load_ms]
+// where load_ms is the time it takes to load the model from disk. if omitted,
+// it is derived from UPRD_SIM_DISK_BANDWIDTH (bytes per second).
+//
+// lines starting with # are ignored in both files.
+
+#include "fmt/format.h"
+#include "upr_eviction.h"
+
+#include <algorithm>
+#include <cmath>
+#include <dmlc/logging.h>
+#include <dmlc/parameter.h>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace upr;
+
+static const auto UPRD_SIM_POLICIES       = dmlc::GetEnv("UPRD_SIM_POLICIES", std::string("lru,fifo,lcu,gdsf,eager"));
+static const auto UPRD_SIM_MEMORY_TOTAL   = dmlc::GetEnv("UPRD_SIM_MEMORY_TOTAL", 16.0 * 1024 * 1024 * 1024);
+static const auto UPRD_SIM_DISK_BANDWIDTH = dmlc::GetEnv("UPRD_SIM_DISK_BANDWIDTH", 500.0 * 1024 * 1024);
+static const auto UPRD_SIM_HIT_LATENCY_MS = dmlc::GetEnv("UPRD_SIM_HIT_LATENCY_MS", 0.1);
+static const auto UPRD_MEMORY_PERCENTAGE  = dmlc::GetEnv("UPRD_MEMORY_PERCENTAGE", 0.8);
+
+struct trace_request {
+  double timestamp_ms{0};
+  std::string model_name{};
+  double hold_ms{0};
+};
+
+struct model_profile {
+  size_t byte_count{0};
+  double load_ms{0};
+};
+
+struct simulation_result {
+  std::string policy{};
+  size_t requests{0};
+  size_t hits{0};
+  // opens that waited on a load issued by a concurrent open
+  size_t coalesced{0};
+  size_t misses{0};
+  // opens that were rejected since not enough memory could be freed
+  size_t failures{0};
+  size_t evictions{0};
+  size_t bytes_loaded{0};
+  // the latencies of every open, infinite for the failed ones
+  std::vector<double> latencies_ms{};
+};
+
+static std::vector<std::string> split(const std::string &line, char delim) {
+  std::vector<std::string> res;
+  std::stringstream ss(line);
+  std::string item;
+  while (std::getline(ss, item, delim)) {
+    res.emplace_back(item);
+  }
+  return res;
+}
+
+static std::vector<std::vector<std::string>> read_csv(const std::string &path) {
+  std::ifstream in(path);
+  if (!in.is_open()) {
+    throw std::runtime_error(fmt::format("unable to open {}", path));
+  }
+  std::vector<std::vector<std::string>> rows;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    rows.emplace_back(split(line, ','));
+  }
+  return rows;
+}
+
+static std::vector<trace_request> read_trace(const std::string &path) {
+  std::vector<trace_request> trace;
+  for (const auto &row : read_csv(path)) {
+    if (row.size() != 3) {
+      throw std::runtime_error(fmt::format("invalid trace line in {}. expecting timestamp_ms,model_name,hold_ms", path));
+    }
+    trace.emplace_back(trace_request{std::stod(row[0]), row[1], std::stod(row[2])});
+  }
+  std::stable_sort(trace.begin(), trace.end(), [](const trace_request &a, const trace_request &b) {
+    return a.timestamp_ms < b.timestamp_ms;
+  });
+  return trace;
+}
+
+static std::unordered_map<std::string, model_profile> read_models(const std::string &path) {
+  std::unordered_map<std::string, model_profile> models;
+  for (const auto &row : read_csv(path)) {
+    if (row.size() != 2 && row.size() != 3) {
+      throw std::runtime_error(
+          fmt::format("invalid model line in {}. expecting model_name,byte_count[,load_ms]", path));
+    }
+    model_profile profile;
+    profile.byte_count = std::stoull(row[1]);
+    profile.load_ms =
+        row.size() == 3 ? std::stod(row[2]) : 1000.0 * profile.byte_count / UPRD_SIM_DISK_BANDWIDTH;
+    models[row[0]] = profile;
+  }
+  return models;
+}
+
+// replays the trace against the eviction logic of the registry. loads of
+// different models proceed in parallel, and concurrent opens of a model that
+// is being loaded wait for that load (as the registry does)
+class simulator {
+public:
+  simulator(std::string policy, size_t max_memory_to_use, const std::unordered_map<std::string, model_profile> &models)
+      : policy_(policy), max_memory_to_use_(max_memory_to_use), models_(models),
+        eviction_index_(make_eviction_index(policy)) {
+    result_.policy = policy;
+  }
+
+  simulation_result run(const std::vector<trace_request> &trace) {
+    for (const auto &request : trace) {
+      events_.push(event{request.timestamp_ms, event_type::open, request.model_name, request.hold_ms});
+    }
+    while (!events_.empty()) {
+      const auto e = events_.top();
+      events_.pop();
+      switch (e.type) {
+      case event_type::open:
+        open(e);
+        break;
+      case event_type::loaded:
+        loaded(e);
+        break;
+      case event_type::close:
+        close(e);
+        break;
+      }
+    }
+    return result_;
+  }
+
+private:
+  enum class event_type { close = 0, loaded = 1, open = 2 };
+
+  struct event {
+    double time_ms;
+    event_type type;
+    std::string model_name;
+    double hold_ms;
+  };
+
+  // orders events by time. at the same time closes are processed before
+  // loads, and loads before opens, so that freed memory is reusable
+  struct event_order {
+    bool operator()(const event &a, const event &b) const {
+      if (a.time_ms != b.time_ms) {
+        return a.time_ms > b.time_ms;
+      }
+      return a.type > b.type;
+    }
+  };
+
+  struct resident_model {
+    size_t byte_count{0};
+    int64_t ref_count{0};
+  };
+
+  struct pending_load {
+    double done_ms{0};
+    // hold times of the opens waiting on the load
+    std::vector<double> waiters{};
+  };
+
+  const model_profile &profile(const std::string &model_name) {
+    const auto it = models_.find(model_name);
+    if (it == models_.end()) {
+      throw std::runtime_error(fmt::format("the model {} is not listed in the model file", model_name));
+    }
+    return it->second;
+  }
+
+  void acquire(const std::string &model_name, double now_ms, double hold_ms) {
+    resident_[model_name].ref_count++;
+    eviction_index_->acquire(model_name);
+    events_.push(event{now_ms + hold_ms, event_type::close, model_name, 0});
+  }
+
+  size_t evict(const std::string &model_name) {
+    const auto byte_count = resident_[model_name].byte_count;
+    memory_usage_ -= byte_count;
+    resident_.erase(model_name);
+    eviction_index_->erase(model_name);
+    result_.evictions++;
+    return byte_count;
+  }
+
+  bool evict_if_needed(size_t byte_count) {
+    if (byte_count > max_memory_to_use_) {
+      return false;
+    }
+    if (memory_usage_ + byte_count <= max_memory_to_use_) {
+      return true;
+    }
+    const auto memory_to_free = memory_usage_ + byte_count - max_memory_to_use_;
+    const auto flush          = policy_ == "flush" || policy_ == "all";
+    size_t memory_freed       = 0;
+    std::string victim;
+    while ((flush || memory_freed < memory_to_free) && eviction_index_->victim(&victim)) {
+      memory_freed += evict(victim);
+    }
+    return memory_freed >= memory_to_free;
+  }
+
+  void open(const event &e) {
+    result_.requests++;
+
+    if (resident_.count(e.model_name) != 0) {
+      result_.hits++;
+      result_.latencies_ms.emplace_back(UPRD_SIM_HIT_LATENCY_MS);
+      acquire(e.model_name, e.time_ms, e.hold_ms);
+      return;
+    }
+
+    auto inflight = loading_.find(e.model_name);
+    if (inflight != loading_.end()) {
+      result_.coalesced++;
+      result_.latencies_ms.emplace_back(inflight->second.done_ms - e.time_ms);
+      inflight->second.waiters.emplace_back(e.hold_ms);
+      return;
+    }
+
+    const auto &model = profile(e.model_name);
+    if (!evict_if_needed(model.byte_count)) {
+      result_.failures++;
+      result_.latencies_ms.emplace_back(std::numeric_limits<double>::infinity());
+      return;
+    }
+
+    result_.misses++;
+    result_.bytes_loaded += model.byte_count;
+    result_.latencies_ms.emplace_back(model.load_ms);
+    // the memory is reserved while the model is loading
+    memory_usage_ += model.byte_count;
+
+    pending_load load;
+    load.done_ms = e.time_ms + model.load_ms;
+    load.waiters.emplace_back(e.hold_ms);
+    loading_[e.model_name] = load;
+    events_.push(event{load.done_ms, event_type::loaded, e.model_name, 0});
+  }
+
+  void loaded(const event &e) {
+    const auto load = loading_[e.model_name];
+    loading_.erase(e.model_name);
+
+    const auto &model               = profile(e.model_name);
+    resident_[e.model_name].byte_count = model.byte_count;
+    eviction_index_->insert(e.model_name, model.byte_count, 1000.0 * model.load_ms);
+
+    for (const auto hold_ms : load.waiters) {
+      acquire(e.model_name, e.time_ms, hold_ms);
+    }
+  }
+
+  void close(const event &e) {
+    auto it = resident_.find(e.model_name);
+    if (it == resident_.end()) {
+      return;
+    }
+    it->second.ref_count--;
+    eviction_index_->release(e.model_name);
+    if (it->second.ref_count == 0 && policy_ == "eager") {
+      evict(e.model_name);
+    }
+  }
+
+  const std::string policy_;
+  const size_t max_memory_to_use_;
+  const std::unordered_map<std::string, model_profile> &models_;
+  std::unique_ptr<eviction_index> eviction_index_;
+
+  std::priority_queue<event, std::vector<event>, event_order> events_{};
+  std::unordered_map<std::string, resident_model> resident_{};
+  std::unordered_map<std::string, pending_load> loading_{};
+  size_t memory_usage_{0};
+  simulation_result result_{};
+};
+
+static double percentile(std::vector<double> values, double p) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * values.size()));
+  return values[std::max(rank, size_t{1}) - 1];
+}
+
+int main(int argc, const char *argv[]) {
+  if (argc != 3) {
+    std::cerr << "usage: " << argv[0] << " <trace_file> <model_file>\n";
+    return 1;
+  }
+
+  const auto trace             = read_trace(argv[1]);
+  const auto models            = read_models(argv[2]);
+  const auto max_memory_to_use = static_cast<size_t>(UPRD_MEMORY_PERCENTAGE * UPRD_SIM_MEMORY_TOTAL);
+
+  LOG(INFO) << "replaying " << trace.size() << " requests over " << models.size()
+            << " models with max_memory_to_use = " << max_memory_to_use;
+
+  std::cout << fmt::format("{:>8} {:>9} {:>8} {:>9} {:>8} {:>8} {:>9} {:>14} {:>10} {:>10} {:>10}\n", "policy",
+                           "requests", "hit_rate", "coalesced", "misses", "failures", "evictions", "bytes_loaded",
+                           "p50_ms", "p95_ms", "p99_ms");
+
+  for (const auto &policy : split(UPRD_SIM_POLICIES, ',')) {
+    simulator sim(policy, max_memory_to_use, models);
+    const auto result   = sim.run(trace);
+    const auto hit_rate = result.requests == 0 ? 0.0 : static_cast<double>(result.hits) / result.requests;
+    std::cout << fmt::format("{:>8} {:>9} {:>8.4f} {:>9} {:>8} {:>8} {:>9} {:>14} {:>10.3f} {:>10.3f} {:>10.3f}\n",
+                             result.policy, result.requests, hit_rate, result.coalesced, result.misses,
+                             result.failures, result.evictions, result.bytes_loaded,
+                             percentile(result.latencies_ms, 50), percentile(result.latencies_ms, 95),
+                             percentile(result.latencies_ms, 99));
+  }
+
+  return 0;
+}